@@ -0,0 +1,125 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_ALIAS_TABLE_HPP
+#define NUMO_RANDOM_ALIAS_TABLE_HPP 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "random_bits.hpp"
+
+/**
+ * Alias table of a discrete distribution built with Vose's variant of Walker's alias method.
+ * Building the table takes O(n) time for n weights, and each value is then sampled in O(1) time
+ * from a single 64-bit random integer: the upper part of its product with n selects a column, and
+ * the lower part decides between the column and its alias.
+ */
+class alias_table {
+public:
+  alias_table() {}
+
+  template<class InputIt> alias_table(InputIt first, InputIt last) {
+    std::vector<double> prob(first, last);
+    const size_t n = prob.size();
+    double sum = 0;
+    for (size_t i = 0; i < n; i++) sum += prob[i];
+    std::vector<size_t> small;
+    std::vector<size_t> large;
+    small.reserve(n);
+    large.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+      prob[i] *= static_cast<double>(n) / sum;
+      if (prob[i] < 1.0) {
+        small.push_back(i);
+      } else {
+        large.push_back(i);
+      }
+    }
+    columns_.resize(n);
+    while (!small.empty() && !large.empty()) {
+      const size_t s = small.back();
+      const size_t l = large.back();
+      small.pop_back();
+      set_column(s, prob[s], l);
+      prob[l] = (prob[l] + prob[s]) - 1.0;
+      if (prob[l] < 1.0) {
+        large.pop_back();
+        small.push_back(l);
+      }
+    }
+    // the columns left over are full, except for rounding errors.
+    for (size_t i = 0; i < large.size(); i++) set_column(large[i], 1.0, large[i]);
+    for (size_t i = 0; i < small.size(); i++) set_column(small[i], 1.0, small[i]);
+  }
+
+  size_t size() const {
+    return columns_.size();
+  }
+
+  template<class Rng> size_t operator()(Rng& rng) const {
+    uint64_t hi;
+    const uint64_t lo = mulhilo64(next_uint64(rng), static_cast<uint64_t>(columns_.size()), hi);
+    const size_t i = static_cast<size_t>(hi);
+    return lo < columns_[i].threshold ? i : columns_[i].alias;
+  }
+
+private:
+  // The column is kept with probability threshold / 2^64, and its alias is chosen otherwise.
+  struct column {
+    uint64_t threshold;
+    size_t alias;
+  };
+
+  std::vector<column> columns_;
+
+  void set_column(const size_t i, const double prob, const size_t alias) {
+    column& col = columns_[i];
+    if (prob >= 1.0) {
+      col.threshold = UINT64_MAX;
+      col.alias = i;
+    } else {
+      col.threshold = static_cast<uint64_t>(prob * 18446744073709551616.0);
+      col.alias = alias;
+    }
+  }
+};
+
+/**
+ * Discrete distribution that samples integers from an alias table shared with the caller.
+ * It refers to the table instead of copying it, so the table must outlive the distribution.
+ */
+template<typename IntType = int> class alias_discrete_distribution {
+public:
+  typedef IntType result_type;
+
+  explicit alias_discrete_distribution(const alias_table& table) : table_(&table) {}
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    return static_cast<IntType>((*table_)(rng));
+  }
+
+private:
+  const alias_table* table_;
+};
+
+#endif /* NUMO_RANDOM_ALIAS_TABLE_HPP */
@@ -0,0 +1,135 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_BERNOULLI_HPP
+#define NUMO_RANDOM_BERNOULLI_HPP 1
+
+#include <stdint.h>
+
+#include "random_bits.hpp"
+
+/**
+ * Bernoulli distribution that decides 64 trials at once. A trial succeeds if a uniform random number
+ * in [0, 1) is less than p, which is held as a 64-bit fixed-point threshold. The uniform numbers of the
+ * 64 trials are compared with the threshold bit by bit from the top, taking one bit of each from a 64-bit
+ * random integer, and the comparison stops when every trial is decided. Each random integer decides about
+ * half of the trials left, and the comparison ends at the lowest set bit of the threshold, so p = 0.5 needs
+ * a single random integer. The results are kept as a bit mask and returned one by one, or in words.
+ */
+template<typename IntType = int> class bitwise_bernoulli_distribution {
+public:
+  typedef IntType result_type;
+
+  explicit bitwise_bernoulli_distribution(const double p = 0.5) : p_(p), mask_(0), n_left_(0) {
+    if (p >= 1.0) {
+      threshold_ = UINT64_MAX;
+    } else if (p > 0.0) {
+      threshold_ = static_cast<uint64_t>(p * 18446744073709551616.0);
+    } else {
+      threshold_ = 0;
+    }
+    always_ = p >= 1.0;
+  }
+
+  double p() const {
+    return p_;
+  }
+
+  void reset() {
+    n_left_ = 0;
+  }
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    return static_cast<IntType>(next_bits(rng, 1));
+  }
+
+  /**
+   * Returns the results of the next n_bits trials, with the first one in the lowest bit.
+   */
+  template<class Rng> uint64_t next_bits(Rng& rng, const int n_bits) {
+    uint64_t res = 0;
+    int filled = 0;
+    while (filled < n_bits) {
+      if (n_left_ == 0) {
+        mask_ = trials(rng);
+        n_left_ = 64;
+      }
+      const int n_taken = n_bits - filled < n_left_ ? n_bits - filled : n_left_;
+      if (n_taken == 64) {
+        res = mask_;
+        mask_ = 0;
+      } else {
+        res |= (mask_ & ((uint64_t(1) << n_taken) - 1)) << filled;
+        mask_ >>= n_taken;
+      }
+      n_left_ -= n_taken;
+      filled += n_taken;
+    }
+    return res;
+  }
+
+private:
+  double p_;
+  uint64_t threshold_;
+  bool always_;
+  uint64_t mask_;
+  int n_left_;
+
+  template<class Rng> uint64_t trials(Rng& rng) const {
+    if (always_) return UINT64_MAX;
+    uint64_t decided = 0;
+    uint64_t success = 0;
+    // the trials still undecided after the lowest set bit of the threshold have uniform numbers not less than it.
+    for (uint64_t bit = uint64_t(1) << 63; bit != 0 && (threshold_ & (bit * 2 - 1)) != 0 && decided != UINT64_MAX; bit >>= 1) {
+      const uint64_t r = next_uint64(rng);
+      if (threshold_ & bit) {
+        success |= ~decided & ~r;
+        decided |= ~r;
+      } else {
+        decided |= r;
+      }
+    }
+    return success;
+  }
+};
+
+/**
+ * Bernoulli distribution that decides each trial with its own uniform random number. It is used when p differs
+ * between the elements, where the trials decided at once by bitwise_bernoulli_distribution cannot be shared.
+ */
+template<typename IntType = int> class inversion_bernoulli_distribution {
+public:
+  typedef IntType result_type;
+
+  explicit inversion_bernoulli_distribution(const double p = 0.5) : p_(p) {}
+
+  double p() const {
+    return p_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    return static_cast<IntType>(next_double(rng) < p_ ? 1 : 0);
+  }
+
+private:
+  double p_;
+};
+
+#endif /* NUMO_RANDOM_BERNOULLI_HPP */
@@ -0,0 +1,194 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_BINOMIAL_HPP
+#define NUMO_RANDOM_BINOMIAL_HPP 1
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "random_bits.hpp"
+
+/**
+ * Binomial distribution sampled with the BTPE algorithm by Kachitvichyanukul and Schmeiser if n * min(p, 1 - p) > 30,
+ * and with the inversion method otherwise, in the same way as NumPy. The setup of either method is computed once
+ * in the constructor. It has the same interface as std::binomial_distribution.
+ */
+template<typename IntType = int> class btpe_binomial_distribution {
+public:
+  typedef IntType result_type;
+
+  explicit btpe_binomial_distribution(const IntType t = 1, const double p = 0.5) : t_(t), p_(p) {
+    n_ = static_cast<int64_t>(t);
+    r_ = std::min(p, 1.0 - p);
+    q_ = 1.0 - r_;
+    use_btpe_ = static_cast<double>(n_) * r_ > 30.0;
+    if (use_btpe_) {
+      init_btpe();
+    } else {
+      init_inversion();
+    }
+  }
+
+  IntType t() const {
+    return t_;
+  }
+
+  double p() const {
+    return p_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    if (n_ == 0 || p_ == 0) return 0;
+    const int64_t y = use_btpe_ ? btpe(rng) : inversion(rng);
+    return static_cast<IntType>(p_ > 0.5 ? n_ - y : y);
+  }
+
+private:
+  IntType t_;
+  double p_;
+  int64_t n_;
+  // the smaller of p and 1 - p, and its complement.
+  double r_;
+  double q_;
+  bool use_btpe_;
+  // setup of BTPE.
+  int64_t m_;
+  double nrq_, fm_, xm_, xl_, xr_, c_, laml_, lamr_, p1_, p2_, p3_, p4_;
+  // setup of the inversion method.
+  double qn_;
+  int64_t bound_;
+
+  void init_btpe() {
+    const double n = static_cast<double>(n_);
+    nrq_ = n * r_ * q_;
+    fm_ = n * r_ + r_;
+    m_ = static_cast<int64_t>(std::floor(fm_));
+    p1_ = std::floor(2.195 * std::sqrt(nrq_) - 4.6 * q_) + 0.5;
+    xm_ = static_cast<double>(m_) + 0.5;
+    xl_ = xm_ - p1_;
+    xr_ = xm_ + p1_;
+    c_ = 0.134 + 20.5 / (15.3 + static_cast<double>(m_));
+    double a = (fm_ - xl_) / (fm_ - xl_ * r_);
+    laml_ = a * (1.0 + a / 2.0);
+    a = (xr_ - fm_) / (xr_ * q_);
+    lamr_ = a * (1.0 + a / 2.0);
+    p2_ = p1_ * (1.0 + 2.0 * c_);
+    p3_ = p2_ + c_ / laml_;
+    p4_ = p3_ + c_ / lamr_;
+  }
+
+  void init_inversion() {
+    const double n = static_cast<double>(n_);
+    qn_ = std::exp(n * std::log(q_));
+    const double np = n * r_;
+    bound_ = static_cast<int64_t>(std::min(n, np + 10.0 * std::sqrt(np * q_ + 1)));
+  }
+
+  // Stirling's series of log(k!) without the leading terms, used in the final acceptance test of BTPE.
+  static double stirling_correction(const double k) {
+    const double k2 = k * k;
+    return (13680. - (462. - (132. - (99. - 140. / k2) / k2) / k2) / k2) / k / 166320.;
+  }
+
+  template<class Rng> int64_t btpe(Rng& rng) const {
+    for (;;) {
+      // step 1: the triangular region in the middle.
+      const double u = next_double(rng) * p4_;
+      double v = next_double(rng);
+      if (u <= p1_) return static_cast<int64_t>(std::floor(xm_ - p1_ * v + u));
+      int64_t y;
+      if (u <= p2_) {
+        // step 2: the parallelograms.
+        const double x = xl_ + (u - p1_) / c_;
+        v = v * c_ + 1.0 - std::fabs(static_cast<double>(m_) - x + 0.5) / p1_;
+        if (v > 1.0) continue;
+        y = static_cast<int64_t>(std::floor(x));
+      } else if (u <= p3_) {
+        // step 3: the left exponential tail.
+        if (v == 0.0) continue;
+        const double yl = std::floor(xl_ + std::log(v) / laml_);
+        if (yl < 0) continue;
+        y = static_cast<int64_t>(yl);
+        v = v * (u - p2_) * laml_;
+      } else {
+        // step 4: the right exponential tail.
+        if (v == 0.0) continue;
+        const double yr = std::floor(xr_ - std::log(v) / lamr_);
+        if (yr > static_cast<double>(n_)) continue;
+        y = static_cast<int64_t>(yr);
+        v = v * (u - p3_) * lamr_;
+      }
+      // step 5: the acceptance test.
+      const int64_t k = y > m_ ? y - m_ : m_ - y;
+      if (k <= 20 || static_cast<double>(k) >= nrq_ / 2.0 - 1) {
+        // evaluate the ratio of the probabilities by recursion.
+        const double s = r_ / q_;
+        const double a = s * static_cast<double>(n_ + 1);
+        double f = 1.0;
+        if (m_ < y) {
+          for (int64_t i = m_ + 1; i <= y; i++) f *= (a / static_cast<double>(i) - s);
+        } else if (m_ > y) {
+          for (int64_t i = y + 1; i <= m_; i++) f /= (a / static_cast<double>(i) - s);
+        }
+        if (v > f) continue;
+        return y;
+      }
+      // squeeze with the bounds of the logarithm of the ratio, then the final test with Stirling's formula.
+      const double kd = static_cast<double>(k);
+      const double rho = (kd / nrq_) * ((kd * (kd / 3.0 + 0.625) + 0.16666666666666666) / nrq_ + 0.5);
+      const double t = -kd * kd / (2 * nrq_);
+      const double la = std::log(v);
+      if (la < t - rho) return y;
+      if (la > t + rho) continue;
+      const double x1 = static_cast<double>(y + 1);
+      const double f1 = static_cast<double>(m_ + 1);
+      const double z = static_cast<double>(n_ + 1 - m_);
+      const double w = static_cast<double>(n_ - y + 1);
+      const double bound = xm_ * std::log(f1 / x1) + (static_cast<double>(n_ - m_) + 0.5) * std::log(z / w)
+                           + static_cast<double>(y - m_) * std::log(w * r_ / (x1 * q_))
+                           + stirling_correction(f1) + stirling_correction(z) + stirling_correction(x1) + stirling_correction(w);
+      if (la > bound) continue;
+      return y;
+    }
+  }
+
+  template<class Rng> int64_t inversion(Rng& rng) const {
+    int64_t x = 0;
+    double px = qn_;
+    double u = next_double(rng);
+    while (u > px) {
+      x++;
+      if (x > bound_) {
+        x = 0;
+        px = qn_;
+        u = next_double(rng);
+      } else {
+        u -= px;
+        px = (static_cast<double>(n_ - x + 1) * r_ * px) / (static_cast<double>(x) * q_);
+      }
+    }
+    return x;
+  }
+};
+
+#endif /* NUMO_RANDOM_BINOMIAL_HPP */
@@ -22,8 +22,19 @@ extern "C" void Init_ext(void) {
   rb_require("numo/narray");
 
   VALUE rb_mNumoRandom = rb_define_module_under(mNumo, "Random");
+  // The version of the in-house sampling algorithms, which is incremented whenever the values generated
+  // from the same seed change.
+  rb_define_const(rb_mNumoRandom, "KERNEL_VERSION", INT2NUM(1));
+  RbNumoRandomSeedSequence::define_class(rb_mNumoRandom, "SeedSequence");
+  RbNumoRandomAliasTable::define_class(rb_mNumoRandom, "AliasTable");
   RbNumoRandomPCG32::define_class(rb_mNumoRandom, "PCG32");
   RbNumoRandomPCG64::define_class(rb_mNumoRandom, "PCG64");
+  RbNumoRandomPCG64Fast::define_class(rb_mNumoRandom, "PCG64Fast");
+  RbNumoRandomPCG64K1024::define_class(rb_mNumoRandom, "PCG64K1024");
+  RbNumoRandomPCG32x8::define_class(rb_mNumoRandom, "PCG32x8");
   RbNumoRandomMT32::define_class(rb_mNumoRandom, "MT32");
   RbNumoRandomMT64::define_class(rb_mNumoRandom, "MT64");
+  RbNumoRandomXoshiro256::define_class(rb_mNumoRandom, "Xoshiro256");
+  RbNumoRandomPhilox4x32::define_class(rb_mNumoRandom, "Philox4x32");
+  RbNumoRandomPhilox4x64::define_class(rb_mNumoRandom, "Philox4x64");
 }
@@ -20,14 +20,528 @@
 #define NUMO_RANDOM_EXT_HPP 1
 
 #include <ruby.h>
+#include <ruby/thread.h>
 
 #include <numo/narray.h>
 #include <numo/template.h>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <random>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include <pcg_random.hpp>
 
+#include "alias_table.hpp"
+#include "bernoulli.hpp"
+#include "binomial.hpp"
+#include "gamma.hpp"
+#include "geometric.hpp"
+#include "mt_jump.hpp"
+#include "pcg_simd.hpp"
+#include "philox.hpp"
+#include "poisson.hpp"
+#include "seed_seq.hpp"
+#include "uniform.hpp"
+#include "xoshiro.hpp"
+#include "ziggurat.hpp"
+
+// Arrays with at least this many elements are filled without holding the GVL.
+#ifndef NUMO_RANDOM_NOGVL_THRESHOLD
+#define NUMO_RANDOM_NOGVL_THRESHOLD 65536
+#endif
+
+// Number of elements filled without the GVL between checks for interrupts.
+#ifndef NUMO_RANDOM_CANCEL_BLOCK
+#define NUMO_RANDOM_CANCEL_BLOCK 4096
+#endif
+
+// The flag that the unblocking function sets when the thread filling an array without the GVL is interrupted.
+// It is NULL while the GVL is held, so that the filling is never cancelled there.
+inline const std::atomic<bool>*& rng_cancel_flag() {
+  static thread_local const std::atomic<bool>* flag = NULL;
+  return flag;
+}
+
+// Returns true if the filling should stop so that the interrupt can be handled. It is polled once per block.
+inline bool rng_cancelled() {
+  const std::atomic<bool>* flag = rng_cancel_flag();
+  return flag != NULL && flag->load(std::memory_order_relaxed);
+}
+
+// Minimum number of elements filled by each thread when an array is filled in parallel.
+#ifndef NUMO_RANDOM_PARALLEL_GRAIN
+#define NUMO_RANDOM_PARALLEL_GRAIN 16384
+#endif
+
+// rng_advance<Rng>::value is true if the engine can jump ahead in logarithmic time.
+template<class Rng> struct rng_advance {
+  static const bool value = false;
+  static void advance(Rng&, const uint64_t) {}
+};
+
+template<typename xtype, typename itype, typename output_mixin, bool output_previous, typename stream_mixin, typename multiplier_mixin>
+struct rng_advance<pcg_detail::engine<xtype, itype, output_mixin, output_previous, stream_mixin, multiplier_mixin>> {
+  static const bool value = true;
+  static void advance(pcg_detail::engine<xtype, itype, output_mixin, output_previous, stream_mixin, multiplier_mixin>& rng, const uint64_t delta) {
+    rng.advance(delta);
+  }
+};
+
+template<pcg_extras::bitcount_t table_pow2, pcg_extras::bitcount_t advance_pow2, typename baseclass, typename extvalclass, bool kdd>
+struct rng_advance<pcg_detail::extended<table_pow2, advance_pow2, baseclass, extvalclass, kdd>> {
+  static const bool value = true;
+  static void advance(pcg_detail::extended<table_pow2, advance_pow2, baseclass, extvalclass, kdd>& rng, const uint64_t delta) {
+    rng.advance(delta);
+  }
+};
+
+template<typename UIntType> struct rng_advance<philox4x_engine<UIntType>> {
+  static const bool value = true;
+  static void advance(philox4x_engine<UIntType>& rng, const uint64_t delta) {
+    rng.discard(delta);
+  }
+};
+
+template<> struct rng_advance<pcg32x8> {
+  static const bool value = true;
+  static void advance(pcg32x8& rng, const uint64_t delta) {
+    rng.discard(delta);
+  }
+};
+
+// The distribution D draws exactly rand_draws<D, Rng>::draws random numbers from the engine
+// for every rand_draws<D, Rng>::elements values it generates. draws is zero if the number is not fixed,
+// for example, when the distribution uses rejection sampling.
+template<class D, class Rng> struct rand_draws {
+  static const size_t draws = 0;
+  static const size_t elements = 1;
+};
+
+template<class Rng> struct rand_draws<bits_uniform_real_distribution<double>, Rng> {
+  // a double is made from a 64-bit random integer.
+  static const size_t draws = Rng::max() > 0xffffffffULL ? 1 : 2;
+  static const size_t elements = 1;
+};
+
+template<class Rng> struct rand_draws<bits_uniform_real_distribution<float>, Rng> {
+  // a float is made from each half of a 64-bit random integer, or from a 32-bit one.
+  static const size_t draws = 1;
+  static const size_t elements = Rng::max() > 0xffffffffULL ? 2 : 1;
+};
+
+template<typename T, class Rng> struct rand_draws<alias_discrete_distribution<T>, Rng> {
+  // the alias table consumes one 64-bit random integer for each value.
+  static const size_t draws = Rng::max() > 0xffffffffULL ? 1 : 2;
+  static const size_t elements = 1;
+};
+
+class RbNumoRandomSeedSequence {
+public:
+  static const rb_data_type_t seed_seq_type;
+  static VALUE rb_cSeedSequence;
+
+  static VALUE numo_random_seed_seq_alloc(VALUE self) {
+    hashmix_seed_seq* ptr = (hashmix_seed_seq*)ruby_xmalloc(sizeof(hashmix_seed_seq));
+    new (ptr) hashmix_seed_seq();
+    return TypedData_Wrap_Struct(self, &seed_seq_type, ptr);
+  }
+
+  static void numo_random_seed_seq_free(void* ptr) {
+    ((hashmix_seed_seq*)ptr)->~hashmix_seed_seq();
+    ruby_xfree(ptr);
+  }
+
+  static size_t numo_random_seed_seq_size(const void* ptr) {
+    return sizeof(hashmix_seed_seq) + ((hashmix_seed_seq*)ptr)->size() * sizeof(uint32_t);
+  }
+
+  static hashmix_seed_seq* get_seed_seq(VALUE self) {
+    hashmix_seed_seq* ptr;
+    TypedData_Get_Struct(self, hashmix_seed_seq, &seed_seq_type, ptr);
+    return ptr;
+  }
+
+  static bool is_seed_seq(VALUE obj) {
+    return rb_typeddata_is_kind_of(obj, &seed_seq_type) != 0;
+  }
+
+  // Creates a new seed sequence with fresh entropy from std::random_device.
+  static VALUE new_seed_seq() {
+    return rb_class_new_instance(0, NULL, rb_cSeedSequence);
+  }
+
+  static VALUE define_class(VALUE rb_mNumoRandom, const char* class_name) {
+    rb_cSeedSequence = rb_define_class_under(rb_mNumoRandom, class_name, rb_cObject);
+    rb_global_variable(&rb_cSeedSequence);
+    rb_define_alloc_func(rb_cSeedSequence, numo_random_seed_seq_alloc);
+    rb_define_method(rb_cSeedSequence, "initialize", RUBY_METHOD_FUNC(_numo_random_seed_seq_init), -1);
+    rb_define_method(rb_cSeedSequence, "initialize_copy", RUBY_METHOD_FUNC(_numo_random_seed_seq_init_copy), 1);
+    rb_define_method(rb_cSeedSequence, "entropy", RUBY_METHOD_FUNC(_numo_random_seed_seq_get_entropy), 0);
+    rb_define_method(rb_cSeedSequence, "spawn_key", RUBY_METHOD_FUNC(_numo_random_seed_seq_get_spawn_key), 0);
+    rb_define_method(rb_cSeedSequence, "pool_size", RUBY_METHOD_FUNC(_numo_random_seed_seq_get_pool_size), 0);
+    rb_define_method(rb_cSeedSequence, "n_children_spawned", RUBY_METHOD_FUNC(_numo_random_seed_seq_get_n_children_spawned), 0);
+    rb_define_method(rb_cSeedSequence, "generate_state", RUBY_METHOD_FUNC(_numo_random_seed_seq_generate_state), -1);
+    rb_define_method(rb_cSeedSequence, "spawn", RUBY_METHOD_FUNC(_numo_random_seed_seq_spawn), 1);
+    return rb_cSeedSequence;
+  }
+
+private:
+  // Appends the 32-bit words of non-negative Integer, or of each element of Array, in little-endian order.
+  static void num2words(VALUE num, std::vector<uint32_t>& words, const char* name) {
+    if (RB_TYPE_P(num, T_ARRAY)) {
+      for (long i = 0; i < RARRAY_LEN(num); i++) num2words(rb_ary_entry(num, i), words, name);
+      return;
+    }
+    if (!RB_INTEGER_TYPE_P(num)) rb_raise(rb_eTypeError, "%s must be an Integer or an Array of Integers", name);
+    if (RTEST(rb_funcall(num, rb_intern("negative?"), 0))) rb_raise(rb_eArgError, "%s must be a non-negative value", name);
+    const size_t n_words = rb_absint_numwords(num, 32, NULL);
+    if (n_words == 0) {
+      words.push_back(0);
+      return;
+    }
+    std::vector<uint32_t> buf(n_words);
+    rb_integer_pack(num, buf.data(), n_words, sizeof(uint32_t), 0, INTEGER_PACK_LSWORD_FIRST | INTEGER_PACK_NATIVE_BYTE_ORDER);
+    words.insert(words.end(), buf.begin(), buf.end());
+  }
+
+  // #initialize
+
+  static VALUE _numo_random_seed_seq_init(int argc, VALUE* argv, VALUE self) {
+    VALUE kw_args = Qnil;
+    ID kw_table[3] = { rb_intern("entropy"), rb_intern("spawn_key"), rb_intern("pool_size") };
+    VALUE kw_values[3] = { Qundef, Qundef, Qundef };
+    rb_scan_args(argc, argv, ":", &kw_args);
+    rb_get_kwargs(kw_args, kw_table, 0, 3, kw_values);
+
+    VALUE entropy = kw_values[0];
+    if (entropy == Qundef || NIL_P(entropy)) {
+      std::random_device rd;
+      uint32_t rd_words[4];
+      for (size_t i = 0; i < 4; i++) rd_words[i] = rd();
+      entropy = rb_integer_unpack(rd_words, 4, sizeof(uint32_t), 0, INTEGER_PACK_LSWORD_FIRST | INTEGER_PACK_NATIVE_BYTE_ORDER);
+    }
+    VALUE spawn_key = kw_values[1] == Qundef ? rb_ary_new() : rb_Array(kw_values[1]);
+    const long pool_size = kw_values[2] == Qundef ? (long)hashmix_seed_seq::default_pool_size : NUM2LONG(kw_values[2]);
+    if (pool_size < (long)hashmix_seed_seq::default_pool_size) rb_raise(rb_eArgError, "pool_size must be >= 4");
+
+    std::vector<uint32_t> entropy_words;
+    std::vector<uint32_t> spawn_key_words;
+    num2words(entropy, entropy_words, "entropy");
+    num2words(spawn_key, spawn_key_words, "spawn_key");
+    new (get_seed_seq(self)) hashmix_seed_seq(entropy_words, spawn_key_words, (size_t)pool_size);
+
+    rb_iv_set(self, "entropy", entropy);
+    rb_iv_set(self, "spawn_key", rb_ary_freeze(rb_ary_dup(spawn_key)));
+    rb_iv_set(self, "pool_size", LONG2NUM(pool_size));
+    rb_iv_set(self, "n_children_spawned", INT2NUM(0));
+    return Qnil;
+  }
+
+  // #initialize_copy
+
+  static VALUE _numo_random_seed_seq_init_copy(VALUE self, VALUE orig) {
+    *get_seed_seq(self) = *get_seed_seq(orig);
+    return self;
+  }
+
+  // #entropy
+
+  static VALUE _numo_random_seed_seq_get_entropy(VALUE self) {
+    return rb_iv_get(self, "entropy");
+  }
+
+  // #spawn_key
+
+  static VALUE _numo_random_seed_seq_get_spawn_key(VALUE self) {
+    return rb_iv_get(self, "spawn_key");
+  }
+
+  // #pool_size
+
+  static VALUE _numo_random_seed_seq_get_pool_size(VALUE self) {
+    return rb_iv_get(self, "pool_size");
+  }
+
+  // #n_children_spawned
+
+  static VALUE _numo_random_seed_seq_get_n_children_spawned(VALUE self) {
+    return rb_iv_get(self, "n_children_spawned");
+  }
+
+  // #generate_state
+
+  static VALUE _numo_random_seed_seq_generate_state(int argc, VALUE* argv, VALUE self) {
+    VALUE n_words_val = Qnil;
+    VALUE kw_args = Qnil;
+    ID kw_table[1] = { rb_intern("dtype") };
+    VALUE kw_values[1] = { Qundef };
+    rb_scan_args(argc, argv, "1:", &n_words_val, &kw_args);
+    rb_get_kwargs(kw_args, kw_table, 0, 1, kw_values);
+
+    const long n_words = NUM2LONG(n_words_val);
+    if (n_words < 0) rb_raise(rb_eArgError, "n_words must be a non-negative value");
+
+    size_t word_size = sizeof(uint32_t);
+    VALUE klass = numo_cUInt32;
+    if (kw_values[0] != Qundef && !NIL_P(kw_values[0])) {
+      const ID dtype = rb_to_id(kw_values[0]);
+      if (dtype == rb_intern("uint64")) {
+        word_size = sizeof(uint64_t);
+        klass = numo_cUInt64;
+      } else if (dtype != rb_intern("uint32")) {
+        rb_raise(rb_eArgError, "dtype must be :uint32 or :uint64");
+      }
+    }
+
+    std::vector<uint32_t> words(n_words * word_size / sizeof(uint32_t));
+    get_seed_seq(self)->generate(words.begin(), words.end());
+
+    size_t shape[1] = { (size_t)n_words };
+    VALUE state = rb_narray_new(klass, 1, shape);
+    if (word_size == sizeof(uint32_t)) {
+      std::copy(words.begin(), words.end(), (uint32_t*)na_get_pointer_for_write(state));
+    } else {
+      uint64_t* ptr = (uint64_t*)na_get_pointer_for_write(state);
+      for (long i = 0; i < n_words; i++) ptr[i] = (uint64_t)words[2 * i] | ((uint64_t)words[2 * i + 1] << 32);
+    }
+    return state;
+  }
+
+  // #spawn
+
+  static VALUE _numo_random_seed_seq_spawn(VALUE self, VALUE n_children) {
+    const long n = NUM2LONG(n_children);
+    if (n < 0) rb_raise(rb_eArgError, "n must be a non-negative value");
+
+    VALUE spawn_key = rb_iv_get(self, "spawn_key");
+    const long n_spawned = NUM2LONG(rb_iv_get(self, "n_children_spawned"));
+    VALUE children = rb_ary_new_capa(n);
+    for (long i = 0; i < n; i++) {
+      VALUE kw_args = rb_hash_new();
+      VALUE child_key = rb_ary_dup(spawn_key);
+      rb_ary_push(child_key, LONG2NUM(n_spawned + i));
+      rb_hash_aset(kw_args, ID2SYM(rb_intern("entropy")), rb_iv_get(self, "entropy"));
+      rb_hash_aset(kw_args, ID2SYM(rb_intern("spawn_key")), child_key);
+      rb_hash_aset(kw_args, ID2SYM(rb_intern("pool_size")), rb_iv_get(self, "pool_size"));
+      rb_ary_push(children, rb_class_new_instance_kw(1, &kw_args, rb_cSeedSequence, RB_PASS_KEYWORDS));
+    }
+    rb_iv_set(self, "n_children_spawned", LONG2NUM(n_spawned + n));
+    return children;
+  }
+};
+
+VALUE RbNumoRandomSeedSequence::rb_cSeedSequence = Qnil;
+
+const rb_data_type_t RbNumoRandomSeedSequence::seed_seq_type = {
+  "RbNumoRandomSeedSequence",
+  {
+    NULL,
+    RbNumoRandomSeedSequence::numo_random_seed_seq_free,
+    RbNumoRandomSeedSequence::numo_random_seed_seq_size
+  },
+  NULL,
+  NULL,
+  0
+};
+
+class RbNumoRandomAliasTable {
+public:
+  static const rb_data_type_t alias_table_type;
+
+  static VALUE numo_random_alias_table_alloc(VALUE self) {
+    alias_table* ptr = (alias_table*)ruby_xmalloc(sizeof(alias_table));
+    new (ptr) alias_table();
+    return TypedData_Wrap_Struct(self, &alias_table_type, ptr);
+  }
+
+  static void numo_random_alias_table_free(void* ptr) {
+    ((alias_table*)ptr)->~alias_table();
+    ruby_xfree(ptr);
+  }
+
+  static size_t numo_random_alias_table_size(const void* ptr) {
+    return sizeof(alias_table) + ((alias_table*)ptr)->size() * (sizeof(uint64_t) + sizeof(size_t));
+  }
+
+  static alias_table* get_alias_table(VALUE self) {
+    alias_table* ptr;
+    TypedData_Get_Struct(self, alias_table, &alias_table_type, ptr);
+    return ptr;
+  }
+
+  static bool is_alias_table(VALUE obj) {
+    return rb_typeddata_is_kind_of(obj, &alias_table_type) != 0;
+  }
+
+  // Checks the type and the shape of the weight array, and returns it as a contiguous array
+  // whose elements begin at na_get_pointer_for_read. A view with an offset is copied, since the pointer does not include it.
+  static VALUE get_weight_array(VALUE w) {
+    VALUE w_klass = rb_obj_class(w);
+    if (w_klass != numo_cSFloat && w_klass != numo_cDFloat) rb_raise(rb_eTypeError, "weight must be Numo::DFloat or Numo::SFloat");
+
+    if (!RTEST(nary_check_contiguous(w)) || na_get_offset(w) != 0) w = nary_dup(w);
+    narray_t* w_nary;
+    GetNArray(w, w_nary);
+    if (NA_NDIM(w_nary) != 1) rb_raise(rb_eArgError, "weight must be 1-dimensional array");
+    if (NA_SHAPE(w_nary)[0] < 1) rb_raise(rb_eArgError, "length of weight must be > 0");
+
+    return w;
+  }
+
+  // Checks that the weights are valid, and returns the number of the positive weights.
+  template<typename P> static size_t check_weight(const P* w_ptr, const size_t w_len) {
+    double sum = 0;
+    size_t n_positive = 0;
+    for (size_t i = 0; i < w_len; i++) {
+      if (!(w_ptr[i] >= 0) || w_ptr[i] == std::numeric_limits<P>::infinity()) rb_raise(rb_eArgError, "weight must be non-negative finite values");
+      sum += w_ptr[i];
+      if (w_ptr[i] > 0) n_positive++;
+    }
+    if (!(sum > 0) || sum == std::numeric_limits<double>::infinity()) rb_raise(rb_eArgError, "sum of weight must be a positive finite value");
+    return n_positive;
+  }
+
+  // Builds the alias table from the weight array, after checking that the weights are valid.
+  static void build_alias_table(VALUE w, alias_table& table) {
+    w = get_weight_array(w);
+    const VALUE w_klass = rb_obj_class(w);
+    narray_t* w_nary;
+    GetNArray(w, w_nary);
+    const size_t w_len = NA_SIZE(w_nary);
+
+    if (w_klass == numo_cSFloat) {
+      const float* w_ptr = (float*)na_get_pointer_for_read(w);
+      check_weight(w_ptr, w_len);
+      table = alias_table(w_ptr, w_ptr + w_len);
+    } else {
+      const double* w_ptr = (double*)na_get_pointer_for_read(w);
+      check_weight(w_ptr, w_len);
+      table = alias_table(w_ptr, w_ptr + w_len);
+    }
+
+    RB_GC_GUARD(w);
+  }
+
+  static VALUE define_class(VALUE rb_mNumoRandom, const char* class_name) {
+    VALUE rb_cAliasTable = rb_define_class_under(rb_mNumoRandom, class_name, rb_cObject);
+    rb_define_alloc_func(rb_cAliasTable, numo_random_alias_table_alloc);
+    rb_define_method(rb_cAliasTable, "initialize", RUBY_METHOD_FUNC(_numo_random_alias_table_init), 1);
+    rb_define_method(rb_cAliasTable, "initialize_copy", RUBY_METHOD_FUNC(_numo_random_alias_table_init_copy), 1);
+    rb_define_method(rb_cAliasTable, "size", RUBY_METHOD_FUNC(_numo_random_alias_table_get_size), 0);
+    return rb_cAliasTable;
+  }
+
+private:
+  // #initialize
+
+  static VALUE _numo_random_alias_table_init(VALUE self, VALUE weight) {
+    build_alias_table(weight, *get_alias_table(self));
+    return Qnil;
+  }
+
+  // #initialize_copy
+
+  static VALUE _numo_random_alias_table_init_copy(VALUE self, VALUE orig) {
+    *get_alias_table(self) = *get_alias_table(orig);
+    return self;
+  }
+
+  // #size
+
+  static VALUE _numo_random_alias_table_get_size(VALUE self) {
+    return SIZET2NUM(get_alias_table(self)->size());
+  }
+};
+
+const rb_data_type_t RbNumoRandomAliasTable::alias_table_type = {
+  "RbNumoRandomAliasTable",
+  {
+    NULL,
+    RbNumoRandomAliasTable::numo_random_alias_table_free,
+    RbNumoRandomAliasTable::numo_random_alias_table_size
+  },
+  NULL,
+  NULL,
+  0
+};
+
+// rand_block<D, Rng>::value is true if the values of the distribution D can be computed from blocks of
+// random numbers written by the block-fill API of the engine, instead of calling the engine for each value.
+template<class D, class Rng> struct rand_block {
+  static const bool value = false;
+  template<typename T> static void fill(D&, Rng&, T*, const size_t) {}
+};
+
+template<> struct rand_block<bits_uniform_real_distribution<float>, pcg32x8> {
+  static const bool value = true;
+  static void fill(bits_uniform_real_distribution<float>& dist, pcg32x8& rng, float* out, const size_t n) {
+    const float scale = dist.b() - dist.a();
+    uint32_t words[256];
+    for (size_t i = 0; i < n; i += 256) {
+      const size_t m = std::min<size_t>(256, n - i);
+      rng.generate(words, m);
+      for (size_t j = 0; j < m; j++) out[i + j] = bits_to_float(words[j]) * scale + dist.a();
+    }
+  }
+};
+
+template<> struct rand_block<bits_uniform_real_distribution<double>, pcg32x8> {
+  static const bool value = true;
+  static void fill(bits_uniform_real_distribution<double>& dist, pcg32x8& rng, double* out, const size_t n) {
+    // the first word goes to the upper half, as in next_uint64.
+    const double scale = dist.b() - dist.a();
+    uint32_t words[256];
+    for (size_t i = 0; i < n; i += 128) {
+      const size_t m = std::min<size_t>(128, n - i);
+      rng.generate(words, 2 * m);
+      for (size_t j = 0; j < m; j++) {
+        out[i + j] = bits_to_double(((uint64_t)words[2 * j] << 32) | words[2 * j + 1]) * scale + dist.a();
+      }
+    }
+  }
+};
+
+// rand_param<D, N>::dist constructs the distribution D from the values of its N parameters,
+// which are used when the parameters are given as NArray and differ between the elements.
+template<class D, int N> struct rand_param;
+
+template<class D> struct rand_param<D, 1> {
+  static D dist(const double* v) {
+    return D(v[0]);
+  }
+};
+
+template<class D> struct rand_param<D, 2> {
+  static D dist(const double* v) {
+    return D(v[0], v[1]);
+  }
+};
+
+// the parameter of #exponential is the scale, which is the inverse of the rate.
+template<typename T> struct rand_param<ziggurat_exponential_distribution<T>, 1> {
+  static ziggurat_exponential_distribution<T> dist(const double* v) {
+    return ziggurat_exponential_distribution<T>(1.0 / v[0]);
+  }
+};
+
+// the number of trials is truncated to an integer as in the case of a scalar.
+// It has been checked to be a non-negative value less than 2^63, so that the cast is well-defined.
+template<typename T> struct rand_param<btpe_binomial_distribution<T>, 2> {
+  static btpe_binomial_distribution<T> dist(const double* v) {
+    return btpe_binomial_distribution<T>(static_cast<T>(static_cast<int64_t>(v[0])), v[1]);
+  }
+};
+
+template<typename T> struct rand_param<gamma_poisson_negative_binomial_distribution<T>, 2> {
+  static gamma_poisson_negative_binomial_distribution<T> dist(const double* v) {
+    return gamma_poisson_negative_binomial_distribution<T>(static_cast<T>(static_cast<int64_t>(v[0])), v[1]);
+  }
+};
+
 template<class Rng, class Impl> class RbNumoRandom {
 public:
   // static const rb_data_type_t rng_type;
@@ -35,7 +549,10 @@ public:
   static VALUE numo_random_alloc(VALUE self) {
     Rng* ptr = (Rng*)ruby_xmalloc(sizeof(Rng));
     new (ptr) Rng();
-    return TypedData_Wrap_Struct(self, &Impl::rng_type, ptr);
+    VALUE obj = TypedData_Wrap_Struct(self, &Impl::rng_type, ptr);
+    rb_iv_set(obj, "lock", rb_mutex_new());
+    rb_iv_set(obj, "threads", INT2NUM(1));
+    return obj;
   }
 
   static void numo_random_free(void* ptr) {
@@ -50,6 +567,7 @@ public:
   static Rng* get_rng(VALUE self) {
     Rng* ptr;
     TypedData_Get_Struct(self, Rng, &Impl::rng_type, ptr);
+    _wait_rng(rb_iv_get(self, "lock"));
     return ptr;
   }
 
@@ -57,9 +575,13 @@ public:
     VALUE rb_cRng = rb_define_class_under(rb_mNumoRandom, class_name, rb_cObject);
     rb_define_alloc_func(rb_cRng, numo_random_alloc);
     rb_define_method(rb_cRng, "initialize", RUBY_METHOD_FUNC(_numo_random_init), -1);
+    rb_define_method(rb_cRng, "initialize_copy", RUBY_METHOD_FUNC(_numo_random_init_copy), 1);
     rb_define_method(rb_cRng, "seed=", RUBY_METHOD_FUNC(_numo_random_set_seed), 1);
     rb_define_method(rb_cRng, "seed", RUBY_METHOD_FUNC(_numo_random_get_seed), 0);
+    rb_define_method(rb_cRng, "threads=", RUBY_METHOD_FUNC(_numo_random_set_threads), 1);
+    rb_define_method(rb_cRng, "threads", RUBY_METHOD_FUNC(_numo_random_get_threads), 0);
     rb_define_method(rb_cRng, "random", RUBY_METHOD_FUNC(_numo_random_random), 0);
+    rb_define_method(rb_cRng, "bernoulli", RUBY_METHOD_FUNC(_numo_random_bernoulli), -1);
     rb_define_method(rb_cRng, "binomial", RUBY_METHOD_FUNC(_numo_random_binomial), -1);
     rb_define_method(rb_cRng, "negative_binomial", RUBY_METHOD_FUNC(_numo_random_negative_binomial), -1);
     rb_define_method(rb_cRng, "geometric", RUBY_METHOD_FUNC(_numo_random_geometric), -1);
@@ -69,6 +591,7 @@ public:
     rb_define_method(rb_cRng, "poisson", RUBY_METHOD_FUNC(_numo_random_poisson), -1);
     rb_define_method(rb_cRng, "weibull", RUBY_METHOD_FUNC(_numo_random_weibull), -1);
     rb_define_method(rb_cRng, "discrete", RUBY_METHOD_FUNC(_numo_random_discrete), -1);
+    rb_define_method(rb_cRng, "integers", RUBY_METHOD_FUNC(_numo_random_integers), -1);
     rb_define_method(rb_cRng, "uniform", RUBY_METHOD_FUNC(_numo_random_uniform), -1);
     rb_define_method(rb_cRng, "cauchy", RUBY_METHOD_FUNC(_numo_random_cauchy), -1);
     rb_define_method(rb_cRng, "chisquare", RUBY_METHOD_FUNC(_numo_random_chisquare), -1);
@@ -76,9 +599,23 @@ public:
     rb_define_method(rb_cRng, "normal", RUBY_METHOD_FUNC(_numo_random_normal), -1);
     rb_define_method(rb_cRng, "lognormal", RUBY_METHOD_FUNC(_numo_random_lognormal), -1);
     rb_define_method(rb_cRng, "standard_t", RUBY_METHOD_FUNC(_numo_random_standard_t), -1);
+    rb_define_method(rb_cRng, "shuffle", RUBY_METHOD_FUNC(_numo_random_shuffle), -1);
+    rb_define_method(rb_cRng, "permutation", RUBY_METHOD_FUNC(_numo_random_permutation), 1);
+    rb_define_method(rb_cRng, "choice", RUBY_METHOD_FUNC(_numo_random_choice), -1);
     return rb_cRng;
   }
 
+protected:
+  // Initializes the engine with Integer seed, or with the state expanded from SeedSequence.
+  static void init_rng(Rng* ptr, VALUE seed) {
+    if (RbNumoRandomSeedSequence::is_seed_seq(seed)) {
+      hashmix_seed_seq seq(*RbNumoRandomSeedSequence::get_seed_seq(seed));
+      new (ptr) Rng(seq);
+    } else {
+      new (ptr) Rng(NUM2LONG(seed));
+    }
+  }
+
 private:
   // #initialize
 
@@ -88,23 +625,24 @@ private:
     VALUE kw_values[1] = { Qundef };
     rb_scan_args(argc, argv, ":", &kw_args);
     rb_get_kwargs(kw_args, kw_table, 0, 1, kw_values);
-    Rng* ptr = get_rng(self);
-    if (kw_values[0] == Qundef || NIL_P(kw_values[0])) {
-      std::random_device rd;
-      const unsigned int seed = rd();
-      new (ptr) Rng(seed);
-      rb_iv_set(self, "seed", UINT2NUM(seed));
-    } else {
-      new (ptr) Rng(NUM2LONG(kw_values[0]));
-      rb_iv_set(self, "seed", kw_values[0]);
-    }
+    VALUE seed = kw_values[0] == Qundef || NIL_P(kw_values[0]) ? RbNumoRandomSeedSequence::new_seed_seq() : kw_values[0];
+    init_rng(get_rng(self), seed);
+    rb_iv_set(self, "seed", seed);
     return Qnil;
   }
 
+  // #initialize_copy
+
+  static VALUE _numo_random_init_copy(VALUE self, VALUE orig) {
+    *get_rng(self) = *get_rng(orig);
+    rb_iv_set(self, "lock", rb_mutex_new());
+    return self;
+  }
+
   // #seed=
 
   static VALUE _numo_random_set_seed(VALUE self, VALUE seed) {
-    get_rng(self)->seed(NUM2LONG(seed));
+    init_rng(get_rng(self), seed);
     rb_iv_set(self, "seed", seed);
     return Qnil;
   }
@@ -115,52 +653,630 @@ private:
     return rb_iv_get(self, "seed");
   }
 
+  // #threads=
+
+  static VALUE _numo_random_set_threads(VALUE self, VALUE threads) {
+    if (NUM2INT(threads) <= 0) rb_raise(rb_eArgError, "threads must be > 0");
+    rb_iv_set(self, "threads", threads);
+    return Qnil;
+  }
+
+  // #threads
+
+  static VALUE _numo_random_get_threads(VALUE self) {
+    return rb_iv_get(self, "threads");
+  }
+
   // #random
 
   static VALUE _numo_random_random(VALUE self) {
-    std::uniform_real_distribution<double> uniform_dist(0, 1);
     Rng* ptr = get_rng(self);
-    const double x = uniform_dist(*ptr);
+    const double x = next_double(*ptr);
     return DBL2NUM(x);
   }
 
   // -- common subroutine --
 
+  struct nogvl_call_t {
+    void* (*func)(void*);
+    void* data;
+    void (*restart)(void*);
+    std::atomic<bool> cancelled;
+    bool done;
+
+    nogvl_call_t(void* (*f)(void*), void* d, void (*r)(void*)) : func(f), data(d), restart(r), cancelled(false), done(false) {}
+  };
+
+  static void* _nogvl_call(void* ptr) {
+    nogvl_call_t* call = (nogvl_call_t*)ptr;
+    rng_cancel_flag() = &call->cancelled;
+    call->func(call->data);
+    rng_cancel_flag() = NULL;
+    call->done = !call->cancelled.load();
+    return NULL;
+  }
+
+  static void _nogvl_cancel(void* ptr) {
+    ((nogvl_call_t*)ptr)->cancelled.store(true);
+  }
+
+  // Calls func without the GVL until it runs to the end. If the thread is interrupted, func stops at the end of
+  // the current block, and the interrupt is handled with the GVL. If the interrupt raises no exception,
+  // as with a signal trap that returns, func is called again from the beginning with the generator still locked,
+  // after restart(data) discards what the cancelled call has left, such as the values kept by the distribution.
+  // The generator is not rewound before the retry, so the values of an interrupted call depend on when it is interrupted.
+  static VALUE _nogvl_run(VALUE ptr) {
+    nogvl_call_t* call = (nogvl_call_t*)ptr;
+    for (;;) {
+      call->cancelled.store(false);
+      call->done = false;
+      // returns without calling func if an interrupt is pending.
+      rb_thread_call_without_gvl2(_nogvl_call, call, _nogvl_cancel, call);
+      if (call->done) break;
+      rb_thread_check_ints();
+      if (call->restart) call->restart(call->data);
+    }
+    return Qnil;
+  }
+
+  // Blocks until no other thread is generating random numbers with the generator guarded by lock.
+  // The current thread holds lock only while it runs an interrupt handler in the middle of filling an array,
+  // and then waiting would never end.
+  static void _wait_rng(VALUE lock) {
+    while (RTEST(rb_mutex_locked_p(lock))) {
+      if (RTEST(rb_funcall(lock, rb_intern("owned?"), 0))) {
+        rb_raise(rb_eThreadError, "random number generator cannot be used by an interrupt handler while it is filling an array");
+      }
+      rb_mutex_lock(lock);
+      rb_mutex_unlock(lock);
+    }
+  }
+
+  // Calls func(data) that draws n random numbers. If n is large, func is called without the GVL
+  // while holding lock, so that other Ruby threads can run during the generation. func must poll
+  // rng_cancelled() once per block and return early if it is true, and must be able to start over
+  // once restart(data) is called, if restart is given.
+  static void _call_rng(VALUE lock, const size_t n, void* (*func)(void*), void* data, void (*restart)(void*) = NULL) {
+    _wait_rng(lock);
+    if (n < NUMO_RANDOM_NOGVL_THRESHOLD) {
+      func(data);
+      return;
+    }
+    nogvl_call_t call(func, data, restart);
+    rb_mutex_lock(lock);
+    rb_ensure(_nogvl_run, (VALUE)&call, rb_mutex_unlock, lock);
+  }
+
   template<class D> struct rand_opt_t {
     D dist;
     Rng* rnd;
+    VALUE lock;
+    size_t threads;
+    size_t count;
   };
 
+  template<class D, typename T> struct rand_fill_t {
+    rand_opt_t<D>* opt;
+    size_t n;
+    char* p1;
+    ssize_t s1;
+    size_t* idx1;
+  };
+
+  // Fills the elements from begin to end block by block, and stops early if the filling is cancelled.
+  template<class D, typename T> static void _fill_rand_range(D& dist, Rng& rng, rand_fill_t<D, T>* fill, const size_t begin, const size_t end) {
+    for (size_t b = begin; b < end && !rng_cancelled(); b += NUMO_RANDOM_CANCEL_BLOCK) {
+      _fill_rand_range_chunk<D, T>(dist, rng, fill, b, std::min<size_t>(b + NUMO_RANDOM_CANCEL_BLOCK, end));
+    }
+  }
+
+  template<class D, typename T> static void _fill_rand_range_chunk(D& dist, Rng& rng, rand_fill_t<D, T>* fill, const size_t begin, const size_t end) {
+    size_t i = end - begin;
+    char* p1 = fill->p1;
+    ssize_t s1 = fill->s1;
+    size_t* idx1 = fill->idx1;
+
+    if (rand_block<D, Rng>::value) {
+      _fill_rand_range_block<D, T>(dist, rng, fill, begin, end);
+    } else if (idx1) {
+      idx1 += begin;
+      for (; i--;) {
+        SET_DATA_INDEX(p1, idx1, T, dist(rng));
+      }
+    } else {
+      p1 += begin * s1;
+      for (; i--;) {
+        SET_DATA_STRIDE(p1, s1, T, dist(rng));
+      }
+    }
+  }
+
+  template<class D, typename T> static void _fill_rand_range_block(D& dist, Rng& rng, rand_fill_t<D, T>* fill, const size_t begin, const size_t end) {
+    char* p1 = fill->p1;
+    ssize_t s1 = fill->s1;
+    size_t* idx1 = fill->idx1;
+
+    if (!idx1 && s1 == sizeof(T)) {
+      rand_block<D, Rng>::fill(dist, rng, (T*)(p1 + begin * s1), end - begin);
+      return;
+    }
+    T buf[256];
+    const size_t chunk = sizeof(buf) / sizeof(T);
+    if (idx1) {
+      idx1 += begin;
+    } else {
+      p1 += begin * s1;
+    }
+    for (size_t i = begin; i < end; i += chunk) {
+      const size_t m = std::min(chunk, end - i);
+      rand_block<D, Rng>::fill(dist, rng, buf, m);
+      if (idx1) {
+        for (size_t j = 0; j < m; j++) SET_DATA_INDEX(p1, idx1, T, buf[j]);
+      } else {
+        for (size_t j = 0; j < m; j++) SET_DATA_STRIDE(p1, s1, T, buf[j]);
+      }
+    }
+  }
+
+  // Fills the array in parallel. Each thread generates its part of the array with a copy of the engine
+  // advanced to the beginning of the part, so that the result is identical to that of serial filling.
+  template<class D, typename T> static void _fill_rand_parallel(rand_fill_t<D, T>* fill) {
+    const size_t draws = rand_draws<D, Rng>::draws;
+    const size_t elements = rand_draws<D, Rng>::elements;
+    rand_opt_t<D>* opt = fill->opt;
+    const size_t n = fill->n;
+
+    // The distribution may keep values generated from the previous draws.
+    const size_t lead = std::min((elements - opt->count % elements) % elements, n);
+    _fill_rand_range<D, T>(opt->dist, *(opt->rnd), fill, 0, lead);
+
+    const size_t n_blocks = (n - lead) / elements;
+    const size_t n_threads = std::max<size_t>(std::min(opt->threads, n_blocks * elements / NUMO_RANDOM_PARALLEL_GRAIN), 1);
+    const size_t blocks_per_thread = (n_blocks + n_threads - 1) / n_threads;
+    const std::atomic<bool>* cancel = rng_cancel_flag();
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < n_threads; t++) {
+      const size_t b_begin = std::min(t * blocks_per_thread, n_blocks);
+      const size_t b_end = std::min(b_begin + blocks_per_thread, n_blocks);
+      auto worker = [=]() {
+        rng_cancel_flag() = cancel;
+        Rng rng(*(opt->rnd));
+        rng_advance<Rng>::advance(rng, b_begin * draws);
+        D dist(opt->dist);
+        dist.reset();
+        _fill_rand_range<D, T>(dist, rng, fill, lead + b_begin * elements, lead + b_end * elements);
+      };
+      try {
+        workers.push_back(std::thread(worker));
+      } catch (...) {
+        worker();
+      }
+    }
+    for (size_t t = 0; t < workers.size(); t++) workers[t].join();
+    if (rng_cancelled()) return;
+    rng_advance<Rng>::advance(*(opt->rnd), n_blocks * draws);
+
+    _fill_rand_range<D, T>(opt->dist, *(opt->rnd), fill, lead + n_blocks * elements, n);
+  }
+
+  template<class D, typename T> static void* _fill_rand(void* ptr) {
+    rand_fill_t<D, T>* fill = (rand_fill_t<D, T>*)ptr;
+    rand_opt_t<D>* opt = fill->opt;
+
+    // the threads are spawned only while the GVL is released.
+    if (rng_advance<Rng>::value && rand_draws<D, Rng>::draws > 0 && opt->threads > 1 && fill->n >= NUMO_RANDOM_NOGVL_THRESHOLD
+        && fill->n >= 2 * NUMO_RANDOM_PARALLEL_GRAIN) {
+      _fill_rand_parallel<D, T>(fill);
+    } else {
+      _fill_rand_range<D, T>(opt->dist, *(opt->rnd), fill, 0, fill->n);
+    }
+    if (!rng_cancelled()) opt->count += fill->n;
+    return NULL;
+  }
+
+  // Discards the values kept by the distribution before the cancelled fill starts over from the beginning.
+  template<class F> static void _restart_rand(void* ptr) {
+    F* fill = (F*)ptr;
+    fill->opt->dist.reset();
+    fill->opt->count = 0;
+  }
+
   template<class D, typename T> static void _iter_rand(na_loop_t* const lp) {
     rand_opt_t<D>* opt = (rand_opt_t<D>*)(lp->opt_ptr);
 
-    size_t i;
+    rand_fill_t<D, T> fill;
+    fill.opt = opt;
+    INIT_COUNTER(lp, fill.n);
+    INIT_PTR_IDX(lp, 0, fill.p1, fill.s1, fill.idx1);
+
+    _call_rng(opt->lock, fill.n, _fill_rand<D, T>, &fill, _restart_rand<rand_fill_t<D, T> >);
+  }
+
+  template<class D, typename T> static void _ndloop_rand(VALUE& self, VALUE& x, const D& dist) {
+    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
+    ndfunc_t ndf = { _iter_rand<D, T>, FULL_LOOP, 1, 0, ain, 0 };
+    const size_t threads = NUM2SIZET(rb_iv_get(self, "threads"));
+    rand_opt_t<D> opt = { dist, get_rng(self), rb_iv_get(self, "lock"), threads, 0 };
+    na_ndloop3(&ndf, &opt, 1, x);
+  }
+
+  template<class D> struct rand_bit_fill_t {
+    rand_opt_t<D>* opt;
+    size_t n;
+    BIT_DIGIT* a1;
+    size_t p1;
+    ssize_t s1;
+    size_t* idx1;
+  };
+
+  // Fills the bit array with the distribution D, which also gives the values of the next n_bits elements
+  // as a word with dist.next_bits(rng, n_bits). Contiguous parts of the array are written by whole digits.
+  template<class D> static void* _fill_rand_bit(void* ptr) {
+    rand_bit_fill_t<D>* fill = (rand_bit_fill_t<D>*)ptr;
+    D& dist = fill->opt->dist;
+    Rng& rng = *(fill->opt->rnd);
+    size_t i = fill->n;
+    BIT_DIGIT* a1 = fill->a1;
+    size_t p1 = fill->p1;
+    ssize_t s1 = fill->s1;
+    size_t* idx1 = fill->idx1;
+
+    if (idx1) {
+      for (; i--;) {
+        if (i % NUMO_RANDOM_CANCEL_BLOCK == 0 && rng_cancelled()) return NULL;
+        STORE_BIT(a1, p1 + *idx1, dist(rng));
+        idx1++;
+      }
+    } else if (s1 == 1) {
+      for (; i > 0 && p1 % NB != 0; i--, p1++) STORE_BIT(a1, p1, dist(rng));
+      BIT_DIGIT* digit = a1 + p1 / NB;
+      for (; i >= NB; i -= NB, p1 += NB) {
+        if (p1 % NUMO_RANDOM_CANCEL_BLOCK == 0 && rng_cancelled()) return NULL;
+        *(digit++) = (BIT_DIGIT)dist.next_bits(rng, (int)NB);
+      }
+      for (; i > 0; i--, p1++) STORE_BIT(a1, p1, dist(rng));
+    } else {
+      for (; i--;) {
+        if (i % NUMO_RANDOM_CANCEL_BLOCK == 0 && rng_cancelled()) return NULL;
+        STORE_BIT(a1, p1, dist(rng));
+        p1 += s1;
+      }
+    }
+    fill->opt->count += fill->n;
+    return NULL;
+  }
+
+  template<class D> static void _iter_rand_bit(na_loop_t* const lp) {
+    rand_opt_t<D>* opt = (rand_opt_t<D>*)(lp->opt_ptr);
+
+    rand_bit_fill_t<D> fill;
+    fill.opt = opt;
+    INIT_COUNTER(lp, fill.n);
+    INIT_PTR_BIT_IDX(lp, 0, fill.a1, fill.p1, fill.s1, fill.idx1);
+
+    _call_rng(opt->lock, fill.n, _fill_rand_bit<D>, &fill, _restart_rand<rand_bit_fill_t<D> >);
+  }
+
+  template<class D> static void _ndloop_rand_bit(VALUE& self, VALUE& x, const D& dist) {
+    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
+    ndfunc_t ndf = { _iter_rand_bit<D>, FULL_LOOP, 1, 0, ain, 0 };
+    const size_t threads = NUM2SIZET(rb_iv_get(self, "threads"));
+    rand_opt_t<D> opt = { dist, get_rng(self), rb_iv_get(self, "lock"), threads, 0 };
+    na_ndloop3(&ndf, &opt, 1, x);
+  }
+
+  // -- parameters given as NArray --
+
+  // Returns true if any of the parameters is given as NArray. Then each element is drawn with the values of
+  // the parameters at the element, where the parameter arrays are broadcast to the shape of the array.
+  static bool _has_param_array(const VALUE* kw_values, const int n_params) {
+    for (int i = 0; i < n_params; i++) {
+      if (kw_values[i] != Qundef && IsNArray(kw_values[i])) return true;
+    }
+    return false;
+  }
+
+  // Casts the parameters to DFloat, with the default values for the ones not given,
+  // and checks that their shapes can be broadcast to the shape of x.
+  static void _cast_params(VALUE x, const ID* kw_table, const VALUE* kw_values, const double* defaults, const int n_params, VALUE* params) {
+    narray_t* x_na;
+    GetNArray(x, x_na);
+    for (int i = 0; i < n_params; i++) {
+      const VALUE val = kw_values[i] == Qundef ? DBL2NUM(defaults[i]) : kw_values[i];
+      params[i] = rb_funcall(numo_cDFloat, rb_intern("cast"), 1, val);
+      narray_t* p_na;
+      GetNArray(params[i], p_na);
+      bool broadcastable = NA_NDIM(p_na) <= NA_NDIM(x_na);
+      for (int d = 1; broadcastable && d <= NA_NDIM(p_na); d++) {
+        const size_t len = NA_SHAPE(p_na)[NA_NDIM(p_na) - d];
+        broadcastable = len == 1 || len == NA_SHAPE(x_na)[NA_NDIM(x_na) - d];
+      }
+      if (!broadcastable) rb_raise(rb_eArgError, "shape of %s does not match the shape of the array", rb_id2name(kw_table[i]));
+    }
+  }
+
+  template<int N> static void _get_params(char** p, ssize_t* s, size_t** idx, double* v) {
+    for (int j = 0; j < N; j++) {
+      if (idx[j]) {
+        GET_DATA_INDEX(p[j], idx[j], double, v[j]);
+      } else {
+        GET_DATA_STRIDE(p[j], s[j], double, v[j]);
+      }
+    }
+  }
+
+  struct param_check_t {
+    bool (*invalid)(const double*);
+    bool found;
+  };
+
+  template<int N> static void _iter_check_params(na_loop_t* const lp) {
+    param_check_t* check = (param_check_t*)(lp->opt_ptr);
+    size_t n;
+    char* p[N];
+    ssize_t s[N];
+    size_t* idx[N];
+    INIT_COUNTER(lp, n);
+    for (int j = 0; j < N; j++) INIT_PTR_IDX(lp, j, p[j], s[j], idx[j]);
+
+    double v[N];
+    for (; n > 0 && !check->found; n--) {
+      _get_params<N>(p, s, idx, v);
+      check->found = check->invalid(v);
+    }
+  }
+
+  // Raises ArgumentError with msg if invalid(v) holds for the values v of the parameters at any element.
+  template<int N> static void _check_params(VALUE* params, bool (*invalid)(const double*), const char* msg) {
+    ndfunc_arg_in_t ain[N];
+    for (int j = 0; j < N; j++) {
+      ain[j].type = numo_cDFloat;
+      ain[j].dim = 0;
+    }
+    ndfunc_t ndf = { _iter_check_params<N>, FULL_LOOP, N, 0, ain, 0 };
+    param_check_t check = { invalid, false };
+    na_ndloop3(&ndf, &check, N, params[0], N > 1 ? params[1] : Qnil);
+    if (check.found) rb_raise(rb_eArgError, "%s", msg);
+  }
+
+  template<class D, int N> struct rand_param_fill_t {
+    rand_opt_t<D>* opt;
+    size_t n;
     char* p1;
     ssize_t s1;
     size_t* idx1;
-    INIT_COUNTER(lp, i);
-    INIT_PTR_IDX(lp, 0, p1, s1, idx1);
+    BIT_DIGIT* a1;
+    size_t b1;
+    char* p[N];
+    ssize_t s[N];
+    size_t* idx[N];
+  };
+
+  // Draws each element from the distribution D with the values of the parameters at the element.
+  // The distribution is constructed again only when the values differ from those of the previous element,
+  // so that the setup of the distribution is shared by the elements of a broadcast parameter.
+  template<class D, typename T, int N> static void* _fill_rand_param(void* ptr) {
+    rand_param_fill_t<D, N>* fill = (rand_param_fill_t<D, N>*)ptr;
+    D& dist = fill->opt->dist;
+    Rng& rng = *(fill->opt->rnd);
+    char* p1 = fill->p1;
+    ssize_t s1 = fill->s1;
+    size_t* idx1 = fill->idx1;
+    char* p[N];
+    ssize_t s[N];
+    size_t* idx[N];
+    for (int j = 0; j < N; j++) {
+      p[j] = fill->p[j];
+      s[j] = fill->s[j];
+      idx[j] = fill->idx[j];
+    }
+
+    double v[N];
+    double prev[N];
+    for (size_t i = 0; i < fill->n; i++) {
+      if (i % NUMO_RANDOM_CANCEL_BLOCK == 0 && rng_cancelled()) return NULL;
+      _get_params<N>(p, s, idx, v);
+      if (i == 0 || !std::equal(v, v + N, prev)) {
+        dist = rand_param<D, N>::dist(v);
+        std::copy(v, v + N, prev);
+      }
+      if (idx1) {
+        SET_DATA_INDEX(p1, idx1, T, dist(rng));
+      } else {
+        SET_DATA_STRIDE(p1, s1, T, dist(rng));
+      }
+    }
+    fill->opt->count += fill->n;
+    return NULL;
+  }
+
+  template<class D, typename T, int N> static void _iter_rand_param(na_loop_t* const lp) {
+    rand_opt_t<D>* opt = (rand_opt_t<D>*)(lp->opt_ptr);
+
+    rand_param_fill_t<D, N> fill;
+    fill.opt = opt;
+    INIT_COUNTER(lp, fill.n);
+    INIT_PTR_IDX(lp, 0, fill.p1, fill.s1, fill.idx1);
+    for (int j = 0; j < N; j++) INIT_PTR_IDX(lp, j + 1, fill.p[j], fill.s[j], fill.idx[j]);
+
+    _call_rng(opt->lock, fill.n, _fill_rand_param<D, T, N>, &fill, _restart_rand<rand_param_fill_t<D, N> >);
+  }
+
+  template<class D, typename T, int N> static void _ndloop_rand_param(VALUE& self, VALUE& x, VALUE* params) {
+    ndfunc_arg_in_t ain[N + 1];
+    ain[0].type = OVERWRITE;
+    ain[0].dim = 0;
+    for (int j = 0; j < N; j++) {
+      ain[j + 1].type = numo_cDFloat;
+      ain[j + 1].dim = 0;
+    }
+    ndfunc_t ndf = { _iter_rand_param<D, T, N>, FULL_LOOP, N + 1, 0, ain, 0 };
+    const size_t threads = NUM2SIZET(rb_iv_get(self, "threads"));
+    rand_opt_t<D> opt = { D(), get_rng(self), rb_iv_get(self, "lock"), threads, 0 };
+    na_ndloop3(&ndf, &opt, N + 1, x, params[0], N > 1 ? params[1] : Qnil);
+  }
+
+  template<class D, int N> static void* _fill_rand_param_bit(void* ptr) {
+    rand_param_fill_t<D, N>* fill = (rand_param_fill_t<D, N>*)ptr;
+    D& dist = fill->opt->dist;
+    Rng& rng = *(fill->opt->rnd);
+    BIT_DIGIT* a1 = fill->a1;
+    size_t p1 = fill->b1;
+    ssize_t s1 = fill->s1;
+    size_t* idx1 = fill->idx1;
+    char* p[N];
+    ssize_t s[N];
+    size_t* idx[N];
+    for (int j = 0; j < N; j++) {
+      p[j] = fill->p[j];
+      s[j] = fill->s[j];
+      idx[j] = fill->idx[j];
+    }
+
+    double v[N];
+    double prev[N];
+    for (size_t i = 0; i < fill->n; i++) {
+      if (i % NUMO_RANDOM_CANCEL_BLOCK == 0 && rng_cancelled()) return NULL;
+      _get_params<N>(p, s, idx, v);
+      if (i == 0 || !std::equal(v, v + N, prev)) {
+        dist = rand_param<D, N>::dist(v);
+        std::copy(v, v + N, prev);
+      }
+      if (idx1) {
+        STORE_BIT(a1, p1 + *idx1, dist(rng));
+        idx1++;
+      } else {
+        STORE_BIT(a1, p1, dist(rng));
+        p1 += s1;
+      }
+    }
+    fill->opt->count += fill->n;
+    return NULL;
+  }
+
+  template<class D, int N> static void _iter_rand_param_bit(na_loop_t* const lp) {
+    rand_opt_t<D>* opt = (rand_opt_t<D>*)(lp->opt_ptr);
+
+    rand_param_fill_t<D, N> fill;
+    fill.opt = opt;
+    INIT_COUNTER(lp, fill.n);
+    INIT_PTR_BIT_IDX(lp, 0, fill.a1, fill.b1, fill.s1, fill.idx1);
+    for (int j = 0; j < N; j++) INIT_PTR_IDX(lp, j + 1, fill.p[j], fill.s[j], fill.idx[j]);
+
+    _call_rng(opt->lock, fill.n, _fill_rand_param_bit<D, N>, &fill, _restart_rand<rand_param_fill_t<D, N> >);
+  }
+
+  template<class D, int N> static void _ndloop_rand_param_bit(VALUE& self, VALUE& x, VALUE* params) {
+    ndfunc_arg_in_t ain[N + 1];
+    ain[0].type = OVERWRITE;
+    ain[0].dim = 0;
+    for (int j = 0; j < N; j++) {
+      ain[j + 1].type = numo_cDFloat;
+      ain[j + 1].dim = 0;
+    }
+    ndfunc_t ndf = { _iter_rand_param_bit<D, N>, FULL_LOOP, N + 1, 0, ain, 0 };
+    const size_t threads = NUM2SIZET(rb_iv_get(self, "threads"));
+    rand_opt_t<D> opt = { D(), get_rng(self), rb_iv_get(self, "lock"), threads, 0 };
+    na_ndloop3(&ndf, &opt, N + 1, x, params[0], N > 1 ? params[1] : Qnil);
+  }
+
+  // Fills x of the integer type klass with D<T> whose parameters are given as NArray.
+  template<template<typename> class D, int N> static void _rand_param_int(VALUE& self, VALUE& x, const VALUE klass, VALUE* params) {
+    if (klass == numo_cInt8) {
+      _ndloop_rand_param<D<int8_t>, int8_t, N>(self, x, params);
+    } else if (klass == numo_cInt16) {
+      _ndloop_rand_param<D<int16_t>, int16_t, N>(self, x, params);
+    } else if (klass == numo_cInt32) {
+      _ndloop_rand_param<D<int32_t>, int32_t, N>(self, x, params);
+    } else if (klass == numo_cInt64) {
+      _ndloop_rand_param<D<int64_t>, int64_t, N>(self, x, params);
+    } else if (klass == numo_cUInt8) {
+      _ndloop_rand_param<D<uint8_t>, uint8_t, N>(self, x, params);
+    } else if (klass == numo_cUInt16) {
+      _ndloop_rand_param<D<uint16_t>, uint16_t, N>(self, x, params);
+    } else if (klass == numo_cUInt32) {
+      _ndloop_rand_param<D<uint32_t>, uint32_t, N>(self, x, params);
+    } else if (klass == numo_cUInt64) {
+      _ndloop_rand_param<D<uint64_t>, uint64_t, N>(self, x, params);
+    }
+  }
+
+  // Fills x of the floating point type klass with D<T> whose parameters are given as NArray.
+  template<template<typename> class D, int N> static void _rand_param_float(VALUE& self, VALUE& x, const VALUE klass, VALUE* params) {
+    if (klass == numo_cSFloat) {
+      _ndloop_rand_param<D<float>, float, N>(self, x, params);
+    } else {
+      _ndloop_rand_param<D<double>, double, N>(self, x, params);
+    }
+  }
+
+  // #bernoulli
+
+  template<typename T> static void _rand_bernoulli(VALUE& self, VALUE& x, const double& p) {
+    bitwise_bernoulli_distribution<T> bernoulli_dist(p);
+    _ndloop_rand<bitwise_bernoulli_distribution<T>, T>(self, x, bernoulli_dist);
+  }
+
+  static VALUE _numo_random_bernoulli(int argc, VALUE* argv, VALUE self) {
+    VALUE x = Qnil;
+    VALUE kw_args = Qnil;
+    ID kw_table[1] = { rb_intern("p") };
+    VALUE kw_values[1] = { Qundef };
+    rb_scan_args(argc, argv, "1:", &x, &kw_args);
+    rb_get_kwargs(kw_args, kw_table, 1, 0, kw_values);
 
-    if (idx1) {
-      for (; i--;) {
-        SET_DATA_INDEX(p1, idx1, T, opt->dist(*(opt->rnd)));
-      }
-    } else {
-      for (; i--;) {
-        SET_DATA_STRIDE(p1, s1, T, opt->dist(*(opt->rnd)));
+    const VALUE klass = rb_obj_class(x);
+    if (klass != numo_cInt8 && klass != numo_cInt16 && klass != numo_cInt32 && klass != numo_cInt64
+        && klass != numo_cUInt8 && klass != numo_cUInt16 && klass != numo_cUInt32 && klass != numo_cUInt64 && klass != numo_cBit)
+      rb_raise(rb_eTypeError, "invalid NArray class, it must be integer typed array or Bit");
+
+    if (_has_param_array(kw_values, 1)) {
+      const double defaults[1] = { 0.0 };
+      VALUE params[1];
+      _cast_params(x, kw_table, kw_values, defaults, 1, params);
+      _check_params<1>(params, [](const double* v) { return !(v[0] >= 0.0 && v[0] <= 1.0); }, "p must be >= 0 and <= 1");
+      if (klass == numo_cBit) {
+        _ndloop_rand_param_bit<inversion_bernoulli_distribution<uint8_t>, 1>(self, x, params);
+      } else {
+        _rand_param_int<inversion_bernoulli_distribution, 1>(self, x, klass, params);
       }
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
+    const double p = NUM2DBL(kw_values[0]);
+    if (!(p >= 0.0 && p <= 1.0)) rb_raise(rb_eArgError, "p must be >= 0 and <= 1");
+
+    if (klass == numo_cBit) {
+      bitwise_bernoulli_distribution<uint8_t> bernoulli_dist(p);
+      _ndloop_rand_bit<bitwise_bernoulli_distribution<uint8_t> >(self, x, bernoulli_dist);
+    } else if (klass == numo_cInt8) {
+      _rand_bernoulli<int8_t>(self, x, p);
+    } else if (klass == numo_cInt16) {
+      _rand_bernoulli<int16_t>(self, x, p);
+    } else if (klass == numo_cInt32) {
+      _rand_bernoulli<int32_t>(self, x, p);
+    } else if (klass == numo_cInt64) {
+      _rand_bernoulli<int64_t>(self, x, p);
+    } else if (klass == numo_cUInt8) {
+      _rand_bernoulli<uint8_t>(self, x, p);
+    } else if (klass == numo_cUInt16) {
+      _rand_bernoulli<uint16_t>(self, x, p);
+    } else if (klass == numo_cUInt32) {
+      _rand_bernoulli<uint32_t>(self, x, p);
+    } else if (klass == numo_cUInt64) {
+      _rand_bernoulli<uint64_t>(self, x, p);
     }
+
+    RB_GC_GUARD(x);
+    return Qnil;
   }
 
   // #binomial
 
   template<typename T> static void _rand_binomial(VALUE& self, VALUE& x, const long n, const double& p) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::binomial_distribution<T> binomial_dist(n, p);
-    ndfunc_t ndf = { _iter_rand<std::binomial_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::binomial_distribution<T>> opt = { binomial_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+    btpe_binomial_distribution<T> binomial_dist(n, p);
+    _ndloop_rand<btpe_binomial_distribution<T>, T>(self, x, binomial_dist);
   }
 
   static VALUE _numo_random_binomial(int argc, VALUE* argv, VALUE self) {
@@ -176,6 +1292,18 @@ private:
         && klass != numo_cUInt8 && klass != numo_cUInt16 && klass != numo_cUInt32 && klass != numo_cUInt64)
       rb_raise(rb_eTypeError, "invalid NArray class, it must be integer typed array");
 
+    if (_has_param_array(kw_values, 2)) {
+      const double defaults[2] = { 0.0, 0.0 };
+      VALUE params[2];
+      _cast_params(x, kw_table, kw_values, defaults, 2, params);
+      _check_params<2>(params, [](const double* v) { return !(v[0] >= 0); }, "n must be a non-negative value");
+      _check_params<2>(params, [](const double* v) { return !(v[0] < 9223372036854775808.0); }, "n must be < 2**63");
+      _check_params<2>(params, [](const double* v) { return !(v[1] >= 0.0 && v[1] <= 1.0); }, "p must be >= 0 and <= 1");
+      _rand_param_int<btpe_binomial_distribution, 2>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
     const long n = NUM2LONG(kw_values[0]);
     const double p = NUM2DBL(kw_values[1]);
     if (n < 0) rb_raise(rb_eArgError, "n must be a non-negative value");
@@ -206,12 +1334,8 @@ private:
   // #negative_binomial
 
   template<typename T> static void _rand_negative_binomial(VALUE& self, VALUE& x, const long n, const double& p) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::negative_binomial_distribution<T> negative_binomial_dist(n, p);
-    ndfunc_t ndf = { _iter_rand<std::negative_binomial_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::negative_binomial_distribution<T>> opt = { negative_binomial_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+    gamma_poisson_negative_binomial_distribution<T> negative_binomial_dist(n, p);
+    _ndloop_rand<gamma_poisson_negative_binomial_distribution<T>, T>(self, x, negative_binomial_dist);
   }
 
   static VALUE _numo_random_negative_binomial(int argc, VALUE* argv, VALUE self) {
@@ -227,6 +1351,18 @@ private:
         && klass != numo_cUInt8 && klass != numo_cUInt16 && klass != numo_cUInt32 && klass != numo_cUInt64)
       rb_raise(rb_eTypeError, "invalid NArray class, it must be integer typed array");
 
+    if (_has_param_array(kw_values, 2)) {
+      const double defaults[2] = { 0.0, 0.0 };
+      VALUE params[2];
+      _cast_params(x, kw_table, kw_values, defaults, 2, params);
+      _check_params<2>(params, [](const double* v) { return !(v[0] >= 0); }, "n must be a non-negative value");
+      _check_params<2>(params, [](const double* v) { return !(v[0] < 9223372036854775808.0); }, "n must be < 2**63");
+      _check_params<2>(params, [](const double* v) { return !(v[1] > 0.0 && v[1] <= 1.0); }, "p must be > 0 and <= 1");
+      _rand_param_int<gamma_poisson_negative_binomial_distribution, 2>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
     const long n = NUM2LONG(kw_values[0]);
     const double p = NUM2DBL(kw_values[1]);
     if (n < 0) rb_raise(rb_eArgError, "n must be a non-negative value");
@@ -257,12 +1393,8 @@ private:
   // #geometric
 
   template<typename T> static void _rand_geometric(VALUE& self, VALUE& x, const double& p) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::geometric_distribution<T> geometric_dist(p);
-    ndfunc_t ndf = { _iter_rand<std::geometric_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::geometric_distribution<T>> opt = { geometric_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+    inversion_geometric_distribution<T> geometric_dist(p);
+    _ndloop_rand<inversion_geometric_distribution<T>, T>(self, x, geometric_dist);
   }
 
   static VALUE _numo_random_geometric(int argc, VALUE* argv, VALUE self) {
@@ -278,6 +1410,16 @@ private:
         && klass != numo_cUInt8 && klass != numo_cUInt16 && klass != numo_cUInt32 && klass != numo_cUInt64)
       rb_raise(rb_eTypeError, "invalid NArray class, it must be integer typed array");
 
+    if (_has_param_array(kw_values, 1)) {
+      const double defaults[1] = { 0.0 };
+      VALUE params[1];
+      _cast_params(x, kw_table, kw_values, defaults, 1, params);
+      _check_params<1>(params, [](const double* v) { return !(v[0] > 0.0 && v[0] < 1.0); }, "p must be > 0 and < 1");
+      _rand_param_int<inversion_geometric_distribution, 1>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
     const double p = NUM2DBL(kw_values[0]);
     if (p <= 0.0 || p >= 1.0) rb_raise(rb_eArgError, "p must be > 0 and < 1");
 
@@ -306,12 +1448,8 @@ private:
   // #exponential
 
   template<typename T> static void _rand_exponential(VALUE& self, VALUE& x, const double& lam) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::exponential_distribution<T> exponential_dist(lam);
-    ndfunc_t ndf = { _iter_rand<std::exponential_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::exponential_distribution<T>> opt = { exponential_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+    ziggurat_exponential_distribution<T> exponential_dist(lam);
+    _ndloop_rand<ziggurat_exponential_distribution<T>, T>(self, x, exponential_dist);
   }
 
   static VALUE _numo_random_exponential(int argc, VALUE* argv, VALUE self) {
@@ -325,6 +1463,16 @@ private:
     const VALUE klass = rb_obj_class(x);
     if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
 
+    if (_has_param_array(kw_values, 1)) {
+      const double defaults[1] = { 1.0 };
+      VALUE params[1];
+      _cast_params(x, kw_table, kw_values, defaults, 1, params);
+      _check_params<1>(params, [](const double* v) { return !(v[0] > 0); }, "scale must be > 0");
+      _rand_param_float<ziggurat_exponential_distribution, 1>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
     const double scale = kw_values[0] == Qundef ? 1.0 : NUM2DBL(kw_values[0]);
     if (scale <= 0) rb_raise(rb_eArgError, "scale must be > 0");
 
@@ -342,12 +1490,8 @@ private:
   // #gamma
 
   template<typename T> static void _rand_gamma(VALUE& self, VALUE& x, const double& k, const double&scale) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::gamma_distribution<T> gamma_dist(k, scale);
-    ndfunc_t ndf = { _iter_rand<std::gamma_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::gamma_distribution<T>> opt = { gamma_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+    marsaglia_tsang_gamma_distribution<T> gamma_dist(k, scale);
+    _ndloop_rand<marsaglia_tsang_gamma_distribution<T>, T>(self, x, gamma_dist);
   }
 
   static VALUE _numo_random_gamma(int argc, VALUE* argv, VALUE self) {
@@ -361,33 +1505,336 @@ private:
     const VALUE klass = rb_obj_class(x);
     if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
 
+    if (_has_param_array(kw_values, 2)) {
+      const double defaults[2] = { 0.0, 1.0 };
+      VALUE params[2];
+      _cast_params(x, kw_table, kw_values, defaults, 2, params);
+      _check_params<2>(params, [](const double* v) { return !(v[0] > 0); }, "k must be > 0");
+      _check_params<2>(params, [](const double* v) { return !(v[1] > 0); }, "scale must be > 0");
+      _rand_param_float<marsaglia_tsang_gamma_distribution, 2>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
+    const double k = NUM2DBL(kw_values[0]);
+    if (k <= 0) rb_raise(rb_eArgError, "k must be > 0");
+    const double scale = kw_values[1] == Qundef ? 1.0 : NUM2DBL(kw_values[1]);
+    if (scale <= 0) rb_raise(rb_eArgError, "scale must be > 0");
+
+    if (klass == numo_cSFloat) {
+      _rand_gamma<float>(self, x, k, scale);
+    } else {
+      _rand_gamma<double>(self, x, k, scale);
+    }
+
+    RB_GC_GUARD(x);
+    return Qnil;
+  }
+
+  // #gumbel
+
+  template<typename T> static void _rand_gumbel(VALUE& self, VALUE& x, const double& loc, const double&scale) {
+    ziggurat_extreme_value_distribution<T> extreme_value_dist(loc, scale);
+    _ndloop_rand<ziggurat_extreme_value_distribution<T>, T>(self, x, extreme_value_dist);
+  }
+
+  static VALUE _numo_random_gumbel(int argc, VALUE* argv, VALUE self) {
+    VALUE x = Qnil;
+    VALUE kw_args = Qnil;
+    ID kw_table[2] = { rb_intern("loc"), rb_intern("scale") };
+    VALUE kw_values[2] = { Qundef, Qundef };
+    rb_scan_args(argc, argv, "1:", &x, &kw_args);
+    rb_get_kwargs(kw_args, kw_table, 0, 2, kw_values);
+
+    const VALUE klass = rb_obj_class(x);
+    if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
+
+    if (_has_param_array(kw_values, 2)) {
+      const double defaults[2] = { 0.0, 1.0 };
+      VALUE params[2];
+      _cast_params(x, kw_table, kw_values, defaults, 2, params);
+      _check_params<2>(params, [](const double* v) { return !(v[1] > 0); }, "scale must be > 0");
+      _rand_param_float<ziggurat_extreme_value_distribution, 2>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
+    const double loc = kw_values[0] == Qundef ? 0.0 : NUM2DBL(kw_values[0]);
+    const double scale = kw_values[1] == Qundef ? 1.0 : NUM2DBL(kw_values[1]);
+    if (scale <= 0) rb_raise(rb_eArgError, "scale must be > 0");
+
+    if (klass == numo_cSFloat) {
+      _rand_gumbel<float>(self, x, loc, scale);
+    } else {
+      _rand_gumbel<double>(self, x, loc, scale);
+    }
+
+    RB_GC_GUARD(x);
+    return Qnil;
+  }
+
+  // #poisson
+
+  template<typename T> static void _rand_poisson(VALUE& self, VALUE& x, const double& mean) {
+    ptrs_poisson_distribution<T> poisson_dist(mean);
+    _ndloop_rand<ptrs_poisson_distribution<T>, T>(self, x, poisson_dist);
+  }
+
+  static VALUE _numo_random_poisson(int argc, VALUE* argv, VALUE self) {
+    VALUE x = Qnil;
+    VALUE kw_args = Qnil;
+    ID kw_table[1] = { rb_intern("mean") };
+    VALUE kw_values[1] = { Qundef };
+    rb_scan_args(argc, argv, "1:", &x, &kw_args);
+    rb_get_kwargs(kw_args, kw_table, 0, 1, kw_values);
+
+    const VALUE klass = rb_obj_class(x);
+    if (klass != numo_cInt8 && klass != numo_cInt16 && klass != numo_cInt32 && klass != numo_cInt64
+        && klass != numo_cUInt8 && klass != numo_cUInt16 && klass != numo_cUInt32 && klass != numo_cUInt64)
+      rb_raise(rb_eTypeError, "invalid NArray class, it must be integer typed array");
+
+    if (_has_param_array(kw_values, 1)) {
+      const double defaults[1] = { 0.0 };
+      VALUE params[1];
+      _cast_params(x, kw_table, kw_values, defaults, 1, params);
+      _check_params<1>(params, [](const double* v) { return !(v[0] > 0.0); }, "mean must be > 0");
+      _rand_param_int<ptrs_poisson_distribution, 1>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
+    const double mean = kw_values[0] == Qundef ? 0.0 : NUM2DBL(kw_values[0]);
+    if (mean <= 0.0) rb_raise(rb_eArgError, "mean must be > 0");
+
+    if (klass == numo_cInt8) {
+      _rand_poisson<int8_t>(self, x, mean);
+    } else if (klass == numo_cInt16) {
+      _rand_poisson<int16_t>(self, x, mean);
+    } else if (klass == numo_cInt32) {
+      _rand_poisson<int32_t>(self, x, mean);
+    } else if (klass == numo_cInt64) {
+      _rand_poisson<int64_t>(self, x, mean);
+    } else if (klass == numo_cUInt8) {
+      _rand_poisson<uint8_t>(self, x, mean);
+    } else if (klass == numo_cUInt16) {
+      _rand_poisson<uint16_t>(self, x, mean);
+    } else if (klass == numo_cUInt32) {
+      _rand_poisson<uint32_t>(self, x, mean);
+    } else if (klass == numo_cUInt64) {
+      _rand_poisson<uint64_t>(self, x, mean);
+    }
+
+    RB_GC_GUARD(x);
+    return Qnil;
+  }
+
+  // #weibull
+
+  template<typename T> static void _rand_weibull(VALUE& self, VALUE& x, const double& k, const double&scale) {
+    ziggurat_weibull_distribution<T> weibull_dist(k, scale);
+    _ndloop_rand<ziggurat_weibull_distribution<T>, T>(self, x, weibull_dist);
+  }
+
+  static VALUE _numo_random_weibull(int argc, VALUE* argv, VALUE self) {
+    VALUE x = Qnil;
+    VALUE kw_args = Qnil;
+    ID kw_table[2] = { rb_intern("k"), rb_intern("scale") };
+    VALUE kw_values[2] = { Qundef, Qundef };
+    rb_scan_args(argc, argv, "1:", &x, &kw_args);
+    rb_get_kwargs(kw_args, kw_table, 1, 1, kw_values);
+
+    const VALUE klass = rb_obj_class(x);
+    if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
+
+    if (_has_param_array(kw_values, 2)) {
+      const double defaults[2] = { 0.0, 1.0 };
+      VALUE params[2];
+      _cast_params(x, kw_table, kw_values, defaults, 2, params);
+      _check_params<2>(params, [](const double* v) { return !(v[0] > 0); }, "k must be > 0");
+      _check_params<2>(params, [](const double* v) { return !(v[1] > 0); }, "scale must be > 0");
+      _rand_param_float<ziggurat_weibull_distribution, 2>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
     const double k = NUM2DBL(kw_values[0]);
     if (k <= 0) rb_raise(rb_eArgError, "k must be > 0");
     const double scale = kw_values[1] == Qundef ? 1.0 : NUM2DBL(kw_values[1]);
     if (scale <= 0) rb_raise(rb_eArgError, "scale must be > 0");
 
     if (klass == numo_cSFloat) {
-      _rand_gamma<float>(self, x, k, scale);
+      _rand_weibull<float>(self, x, k, scale);
+    } else {
+      _rand_weibull<double>(self, x, k, scale);
+    }
+
+    RB_GC_GUARD(x);
+    return Qnil;
+  }
+
+  // #discrete
+
+  template<typename T> static void _rand_discrete(VALUE& self, VALUE& x, const alias_table& table) {
+    alias_discrete_distribution<T> discrete_dist(table);
+    _ndloop_rand<alias_discrete_distribution<T>, T>(self, x, discrete_dist);
+  }
+
+  static VALUE _numo_random_discrete(int argc, VALUE* argv, VALUE self) {
+    VALUE x = Qnil;
+    VALUE kw_args = Qnil;
+    ID kw_table[1] = { rb_intern("weight") };
+    VALUE kw_values[1] = { Qundef };
+    rb_scan_args(argc, argv, "1:", &x, &kw_args);
+    rb_get_kwargs(kw_args, kw_table, 1, 0, kw_values);
+
+    VALUE klass = rb_obj_class(x);
+    if (klass != numo_cInt8 && klass != numo_cInt16 && klass != numo_cInt32 && klass != numo_cInt64
+        && klass != numo_cUInt8 && klass != numo_cUInt16 && klass != numo_cUInt32 && klass != numo_cUInt64)
+      rb_raise(rb_eTypeError, "invalid NArray class, it must be integer typed array");
+
+    // The weight is either an array of weights or an alias table built from them in advance.
+    VALUE w = kw_values[0];
+    alias_table w_table;
+    const alias_table* table = &w_table;
+    if (RbNumoRandomAliasTable::is_alias_table(w)) {
+      table = RbNumoRandomAliasTable::get_alias_table(w);
+      if (table->size() < 1) rb_raise(rb_eArgError, "alias table is not initialized");
+    } else {
+      RbNumoRandomAliasTable::build_alias_table(w, w_table);
+    }
+
+    if (klass == numo_cInt8) {
+      _rand_discrete<int8_t>(self, x, *table);
+    } else if (klass == numo_cInt16) {
+      _rand_discrete<int16_t>(self, x, *table);
+    } else if (klass == numo_cInt32) {
+      _rand_discrete<int32_t>(self, x, *table);
+    } else if (klass == numo_cInt64) {
+      _rand_discrete<int64_t>(self, x, *table);
+    } else if (klass == numo_cUInt8) {
+      _rand_discrete<uint8_t>(self, x, *table);
+    } else if (klass == numo_cUInt16) {
+      _rand_discrete<uint16_t>(self, x, *table);
+    } else if (klass == numo_cUInt32) {
+      _rand_discrete<uint32_t>(self, x, *table);
+    } else if (klass == numo_cUInt64) {
+      _rand_discrete<uint64_t>(self, x, *table);
+    }
+
+    RB_GC_GUARD(w);
+    RB_GC_GUARD(x);
+    return Qnil;
+  }
+
+  // #integers
+
+  template<typename T> static void _rand_integers(VALUE& self, VALUE& x, VALUE low, VALUE high) {
+    const VALUE t_min = std::numeric_limits<T>::is_signed ? LL2NUM((long long)std::numeric_limits<T>::min()) : INT2FIX(0);
+    const VALUE t_max = std::numeric_limits<T>::is_signed ? LL2NUM((long long)std::numeric_limits<T>::max())
+                                                          : ULL2NUM((unsigned long long)std::numeric_limits<T>::max());
+    const VALUE last = rb_funcall(high, '-', 1, INT2FIX(1));
+    if (RTEST(rb_funcall(low, '<', 1, t_min)) || RTEST(rb_funcall(last, '>', 1, t_max))) {
+      rb_raise(rb_eArgError, "low and high must be within the range of the array type");
+    }
+
+    const T a = std::numeric_limits<T>::is_signed ? (T)NUM2LL(low) : (T)NUM2ULL(low);
+    const uint64_t span = NUM2ULL(rb_funcall(last, '-', 1, low));
+    lemire_uniform_int_distribution<T> integers_dist(a, span);
+    _ndloop_rand<lemire_uniform_int_distribution<T>, T>(self, x, integers_dist);
+  }
+
+  static VALUE _numo_random_integers(int argc, VALUE* argv, VALUE self) {
+    VALUE x = Qnil;
+    VALUE kw_args = Qnil;
+    ID kw_table[2] = { rb_intern("low"), rb_intern("high") };
+    VALUE kw_values[2] = { Qundef, Qundef };
+    rb_scan_args(argc, argv, "1:", &x, &kw_args);
+    rb_get_kwargs(kw_args, kw_table, 2, 0, kw_values);
+
+    const VALUE klass = rb_obj_class(x);
+    if (klass != numo_cInt8 && klass != numo_cInt16 && klass != numo_cInt32 && klass != numo_cInt64
+        && klass != numo_cUInt8 && klass != numo_cUInt16 && klass != numo_cUInt32 && klass != numo_cUInt64)
+      rb_raise(rb_eTypeError, "invalid NArray class, it must be integer typed array");
+
+    VALUE low = kw_values[0];
+    VALUE high = kw_values[1];
+    if (!RB_INTEGER_TYPE_P(low) || !RB_INTEGER_TYPE_P(high)) rb_raise(rb_eTypeError, "low and high must be Integer");
+    if (!RTEST(rb_funcall(low, '<', 1, high))) rb_raise(rb_eArgError, "high must be > low");
+
+    if (klass == numo_cInt8) {
+      _rand_integers<int8_t>(self, x, low, high);
+    } else if (klass == numo_cInt16) {
+      _rand_integers<int16_t>(self, x, low, high);
+    } else if (klass == numo_cInt32) {
+      _rand_integers<int32_t>(self, x, low, high);
+    } else if (klass == numo_cInt64) {
+      _rand_integers<int64_t>(self, x, low, high);
+    } else if (klass == numo_cUInt8) {
+      _rand_integers<uint8_t>(self, x, low, high);
+    } else if (klass == numo_cUInt16) {
+      _rand_integers<uint16_t>(self, x, low, high);
+    } else if (klass == numo_cUInt32) {
+      _rand_integers<uint32_t>(self, x, low, high);
+    } else if (klass == numo_cUInt64) {
+      _rand_integers<uint64_t>(self, x, low, high);
+    }
+
+    RB_GC_GUARD(low);
+    RB_GC_GUARD(high);
+    RB_GC_GUARD(x);
+    return Qnil;
+  }
+
+  // #uniform
+
+  template<typename T> static void _rand_uniform(VALUE& self, VALUE& x, const double& low, const double& high) {
+    bits_uniform_real_distribution<T> uniform_dist(low, high);
+    _ndloop_rand<bits_uniform_real_distribution<T>, T>(self, x, uniform_dist);
+  }
+
+  static VALUE _numo_random_uniform(int argc, VALUE* argv, VALUE self) {
+    VALUE x = Qnil;
+    VALUE kw_args = Qnil;
+    ID kw_table[2] = { rb_intern("low"), rb_intern("high") };
+    VALUE kw_values[2] = { Qundef, Qundef };
+    rb_scan_args(argc, argv, "1:", &x, &kw_args);
+    rb_get_kwargs(kw_args, kw_table, 0, 2, kw_values);
+
+    VALUE klass = rb_obj_class(x);
+    if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
+
+    if (_has_param_array(kw_values, 2)) {
+      const double defaults[2] = { 0.0, 1.0 };
+      VALUE params[2];
+      _cast_params(x, kw_table, kw_values, defaults, 2, params);
+      _check_params<2>(params, [](const double* v) { return !(v[1] - v[0] >= 0); }, "high - low must be > 0");
+      _rand_param_float<bits_uniform_real_distribution, 2>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
+    const double low = kw_values[0] == Qundef ? 0.0 : NUM2DBL(kw_values[0]);
+    const double high = kw_values[1] == Qundef ? 1.0 : NUM2DBL(kw_values[1]);
+    if (high - low < 0) rb_raise(rb_eArgError, "high - low must be > 0");
+
+    if (klass == numo_cSFloat) {
+      _rand_uniform<float>(self, x, low, high);
     } else {
-      _rand_gamma<double>(self, x, k, scale);
+      _rand_uniform<double>(self, x, low, high);
     }
 
     RB_GC_GUARD(x);
     return Qnil;
   }
 
-  // #gumbel
+  // #cauchy
 
-  template<typename T> static void _rand_gumbel(VALUE& self, VALUE& x, const double& loc, const double&scale) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::extreme_value_distribution<T> extreme_value_dist(loc, scale);
-    ndfunc_t ndf = { _iter_rand<std::extreme_value_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::extreme_value_distribution<T>> opt = { extreme_value_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+  template<typename T> static void _rand_cauchy(VALUE& self, VALUE& x, const double& loc, const double& scale) {
+    ziggurat_cauchy_distribution<T> cauchy_dist(loc, scale);
+    _ndloop_rand<ziggurat_cauchy_distribution<T>, T>(self, x, cauchy_dist);
   }
 
-  static VALUE _numo_random_gumbel(int argc, VALUE* argv, VALUE self) {
+  static VALUE _numo_random_cauchy(int argc, VALUE* argv, VALUE self) {
     VALUE x = Qnil;
     VALUE kw_args = Qnil;
     ID kw_table[2] = { rb_intern("loc"), rb_intern("scale") };
@@ -398,442 +1845,750 @@ private:
     const VALUE klass = rb_obj_class(x);
     if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
 
+    if (_has_param_array(kw_values, 2)) {
+      const double defaults[2] = { 0.0, 1.0 };
+      VALUE params[2];
+      _cast_params(x, kw_table, kw_values, defaults, 2, params);
+      _check_params<2>(params, [](const double* v) { return !(v[1] >= 0); }, "scale must be a non-negative value");
+      _rand_param_float<ziggurat_cauchy_distribution, 2>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
     const double loc = kw_values[0] == Qundef ? 0.0 : NUM2DBL(kw_values[0]);
     const double scale = kw_values[1] == Qundef ? 1.0 : NUM2DBL(kw_values[1]);
-    if (scale <= 0) rb_raise(rb_eArgError, "scale must be > 0");
+    if (scale < 0) rb_raise(rb_eArgError, "scale must be a non-negative value");
 
     if (klass == numo_cSFloat) {
-      _rand_gumbel<float>(self, x, loc, scale);
+      _rand_cauchy<float>(self, x, loc, scale);
     } else {
-      _rand_gumbel<double>(self, x, loc, scale);
+      _rand_cauchy<double>(self, x, loc, scale);
     }
 
     RB_GC_GUARD(x);
     return Qnil;
   }
 
-  // #poisson
+  // #chisqure
 
-  template<typename T> static void _rand_poisson(VALUE& self, VALUE& x, const double& mean) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::poisson_distribution<T> poisson_dist(mean);
-    ndfunc_t ndf = { _iter_rand<std::poisson_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::poisson_distribution<T>> opt = { poisson_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+  template<typename T> static void _rand_chisquare(VALUE& self, VALUE& x, const double& df) {
+    marsaglia_tsang_chi_squared_distribution<T> chisquare_dist(df);
+    _ndloop_rand<marsaglia_tsang_chi_squared_distribution<T>, T>(self, x, chisquare_dist);
   }
 
-  static VALUE _numo_random_poisson(int argc, VALUE* argv, VALUE self) {
+  static VALUE _numo_random_chisquare(int argc, VALUE* argv, VALUE self) {
     VALUE x = Qnil;
     VALUE kw_args = Qnil;
-    ID kw_table[1] = { rb_intern("mean") };
+    ID kw_table[1] = { rb_intern("df") };
     VALUE kw_values[1] = { Qundef };
     rb_scan_args(argc, argv, "1:", &x, &kw_args);
-    rb_get_kwargs(kw_args, kw_table, 0, 1, kw_values);
+    rb_get_kwargs(kw_args, kw_table, 1, 0, kw_values);
 
     const VALUE klass = rb_obj_class(x);
-    if (klass != numo_cInt8 && klass != numo_cInt16 && klass != numo_cInt32 && klass != numo_cInt64
-        && klass != numo_cUInt8 && klass != numo_cUInt16 && klass != numo_cUInt32 && klass != numo_cUInt64)
-      rb_raise(rb_eTypeError, "invalid NArray class, it must be integer typed array");
+    if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
 
-    const double mean = kw_values[0] == Qundef ? 0.0 : NUM2DBL(kw_values[0]);
-    if (mean <= 0.0) rb_raise(rb_eArgError, "mean must be > 0");
+    if (_has_param_array(kw_values, 1)) {
+      const double defaults[1] = { 0.0 };
+      VALUE params[1];
+      _cast_params(x, kw_table, kw_values, defaults, 1, params);
+      _check_params<1>(params, [](const double* v) { return !(v[0] > 0); }, "df must be > 0");
+      _rand_param_float<marsaglia_tsang_chi_squared_distribution, 1>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
 
-    if (klass == numo_cInt8) {
-      _rand_poisson<int8_t>(self, x, mean);
-    } else if (klass == numo_cInt16) {
-      _rand_poisson<int16_t>(self, x, mean);
-    } else if (klass == numo_cInt32) {
-      _rand_poisson<int32_t>(self, x, mean);
-    } else if (klass == numo_cInt64) {
-      _rand_poisson<int64_t>(self, x, mean);
-    } else if (klass == numo_cUInt8) {
-      _rand_poisson<uint8_t>(self, x, mean);
-    } else if (klass == numo_cUInt16) {
-      _rand_poisson<uint16_t>(self, x, mean);
-    } else if (klass == numo_cUInt32) {
-      _rand_poisson<uint32_t>(self, x, mean);
-    } else if (klass == numo_cUInt64) {
-      _rand_poisson<uint64_t>(self, x, mean);
+    const double df = NUM2DBL(kw_values[0]);
+    if (df <= 0) rb_raise(rb_eArgError, "df must be > 0");
+
+    if (klass == numo_cSFloat) {
+      _rand_chisquare<float>(self, x, df);
+    } else {
+      _rand_chisquare<double>(self, x, df);
     }
 
     RB_GC_GUARD(x);
     return Qnil;
   }
 
-  // #weibull
+  // #f
 
-  template<typename T> static void _rand_weibull(VALUE& self, VALUE& x, const double& k, const double&scale) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::weibull_distribution<T> weibull_dist(k, scale);
-    ndfunc_t ndf = { _iter_rand<std::weibull_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::weibull_distribution<T>> opt = { weibull_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+  template<typename T> static void _rand_f(VALUE& self, VALUE& x, const double& dfnum, const double& dfden) {
+    marsaglia_tsang_fisher_f_distribution<T> f_dist(dfnum, dfden);
+    _ndloop_rand<marsaglia_tsang_fisher_f_distribution<T>, T>(self, x, f_dist);
   }
 
-  static VALUE _numo_random_weibull(int argc, VALUE* argv, VALUE self) {
+  static VALUE _numo_random_f(int argc, VALUE* argv, VALUE self) {
     VALUE x = Qnil;
     VALUE kw_args = Qnil;
-    ID kw_table[2] = { rb_intern("k"), rb_intern("scale") };
+    ID kw_table[2] = { rb_intern("dfnum"), rb_intern("dfden") };
     VALUE kw_values[2] = { Qundef, Qundef };
     rb_scan_args(argc, argv, "1:", &x, &kw_args);
-    rb_get_kwargs(kw_args, kw_table, 1, 1, kw_values);
+    rb_get_kwargs(kw_args, kw_table, 2, 0, kw_values);
 
     const VALUE klass = rb_obj_class(x);
     if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
 
-    const double k = NUM2DBL(kw_values[0]);
-    if (k <= 0) rb_raise(rb_eArgError, "k must be > 0");
-    const double scale = kw_values[1] == Qundef ? 1.0 : NUM2DBL(kw_values[1]);
-    if (scale <= 0) rb_raise(rb_eArgError, "scale must be > 0");
+    if (_has_param_array(kw_values, 2)) {
+      const double defaults[2] = { 0.0, 0.0 };
+      VALUE params[2];
+      _cast_params(x, kw_table, kw_values, defaults, 2, params);
+      _check_params<2>(params, [](const double* v) { return !(v[0] > 0); }, "dfnum must be > 0");
+      _check_params<2>(params, [](const double* v) { return !(v[1] > 0); }, "dfden must be > 0");
+      _rand_param_float<marsaglia_tsang_fisher_f_distribution, 2>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
+    const double dfnum = NUM2DBL(kw_values[0]);
+    const double dfden = NUM2DBL(kw_values[1]);
+    if (dfnum <= 0) rb_raise(rb_eArgError, "dfnum must be > 0");
+    if (dfden <= 0) rb_raise(rb_eArgError, "dfden must be > 0");
 
     if (klass == numo_cSFloat) {
-      _rand_weibull<float>(self, x, k, scale);
+      _rand_f<float>(self, x, dfnum, dfden);
     } else {
-      _rand_weibull<double>(self, x, k, scale);
+      _rand_f<double>(self, x, dfnum, dfden);
     }
 
     RB_GC_GUARD(x);
     return Qnil;
   }
 
-  // #discrete
+  // #normal
 
-  template<typename T, typename P> static void _rand_discrete(VALUE& self, VALUE& x, const std::vector<P>& weight) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::discrete_distribution<T> discrete_dist(weight.begin(), weight.end());
-    ndfunc_t ndf = { _iter_rand<std::discrete_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::discrete_distribution<T>> opt = { discrete_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+  template<typename T> static void _rand_normal(VALUE& self, VALUE& x, const double& loc, const double& scale) {
+    ziggurat_normal_distribution<T> normal_dist(loc, scale);
+    _ndloop_rand<ziggurat_normal_distribution<T>, T>(self, x, normal_dist);
   }
 
-  static VALUE _numo_random_discrete(int argc, VALUE* argv, VALUE self) {
+  static VALUE _numo_random_normal(int argc, VALUE* argv, VALUE self) {
     VALUE x = Qnil;
     VALUE kw_args = Qnil;
-    ID kw_table[1] = { rb_intern("weight") };
-    VALUE kw_values[1] = { Qundef };
+    ID kw_table[2] = { rb_intern("loc"), rb_intern("scale") };
+    VALUE kw_values[2] = { Qundef, Qundef };
     rb_scan_args(argc, argv, "1:", &x, &kw_args);
-    rb_get_kwargs(kw_args, kw_table, 1, 0, kw_values);
+    rb_get_kwargs(kw_args, kw_table, 0, 2, kw_values);
 
     VALUE klass = rb_obj_class(x);
-    if (klass != numo_cInt8 && klass != numo_cInt16 && klass != numo_cInt32 && klass != numo_cInt64
-        && klass != numo_cUInt8 && klass != numo_cUInt16 && klass != numo_cUInt32 && klass != numo_cUInt64)
-      rb_raise(rb_eTypeError, "invalid NArray class, it must be integer typed array");
-
-    VALUE w = kw_values[0];
-    VALUE w_klass = rb_obj_class(w);
-    if (w_klass != numo_cSFloat && w_klass != numo_cDFloat) rb_raise(rb_eTypeError, "weight must be Numo::DFloat or Numo::SFloat");
+    if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
 
-    if (!RTEST(nary_check_contiguous(w))) w = nary_dup(w);
-    narray_t* w_nary;
-    GetNArray(w, w_nary);
-    if (NA_NDIM(w_nary) != 1) rb_raise(rb_eArgError, "weight must be 1-dimensional array");
+    if (_has_param_array(kw_values, 2)) {
+      const double defaults[2] = { 0.0, 1.0 };
+      VALUE params[2];
+      _cast_params(x, kw_table, kw_values, defaults, 2, params);
+      _check_params<2>(params, [](const double* v) { return !(v[1] >= 0); }, "scale must be a non-negative value");
+      _rand_param_float<ziggurat_normal_distribution, 2>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
 
-    const size_t w_len = NA_SHAPE(w_nary)[0];
-    if (w_len < 1) rb_raise(rb_eArgError, "length of weight must be > 0");
+    const double loc = kw_values[0] == Qundef ? 0.0 : NUM2DBL(kw_values[0]);
+    const double scale = kw_values[1] == Qundef ? 1.0 : NUM2DBL(kw_values[1]);
+    if (scale < 0) rb_raise(rb_eArgError, "scale must be a non-negative value");
 
-    if (w_klass == numo_cSFloat) {
-      const float* w_ptr = (float*)na_get_pointer_for_read(w);
-      std::vector<float> w_vec(w_ptr, w_ptr + w_len);
-      if (klass == numo_cInt8) {
-        _rand_discrete<int8_t, float>(self, x, w_vec);
-      } else if (klass == numo_cInt16) {
-        _rand_discrete<int16_t, float>(self, x, w_vec);
-      } else if (klass == numo_cInt32) {
-        _rand_discrete<int32_t, float>(self, x, w_vec);
-      } else if (klass == numo_cInt64) {
-        _rand_discrete<int64_t, float>(self, x, w_vec);
-      } else if (klass == numo_cUInt8) {
-        _rand_discrete<uint8_t, float>(self, x, w_vec);
-      } else if (klass == numo_cUInt16) {
-        _rand_discrete<uint16_t, float>(self, x, w_vec);
-      } else if (klass == numo_cUInt32) {
-        _rand_discrete<uint32_t, float>(self, x, w_vec);
-      } else if (klass == numo_cUInt64) {
-        _rand_discrete<uint64_t, float>(self, x, w_vec);
-      }
+    if (klass == numo_cSFloat) {
+      _rand_normal<float>(self, x, loc, scale);
     } else {
-      const double* w_ptr = (double*)na_get_pointer_for_read(w);
-      std::vector<double> w_vec(w_ptr, w_ptr + w_len);
-      if (klass == numo_cInt8) {
-        _rand_discrete<int8_t, double>(self, x, w_vec);
-      } else if (klass == numo_cInt16) {
-        _rand_discrete<int16_t, double>(self, x, w_vec);
-      } else if (klass == numo_cInt32) {
-        _rand_discrete<int32_t, double>(self, x, w_vec);
-      } else if (klass == numo_cInt64) {
-        _rand_discrete<int64_t, double>(self, x, w_vec);
-      } else if (klass == numo_cUInt8) {
-        _rand_discrete<uint8_t, double>(self, x, w_vec);
-      } else if (klass == numo_cUInt16) {
-        _rand_discrete<uint16_t, double>(self, x, w_vec);
-      } else if (klass == numo_cUInt32) {
-        _rand_discrete<uint32_t, double>(self, x, w_vec);
-      } else if (klass == numo_cUInt64) {
-        _rand_discrete<uint64_t, double>(self, x, w_vec);
-      }
+      _rand_normal<double>(self, x, loc, scale);
     }
 
-    RB_GC_GUARD(w);
     RB_GC_GUARD(x);
     return Qnil;
   }
 
-  // #uniform
+  // #lognormal
 
-  template<typename T> static void _rand_uniform(VALUE& self, VALUE& x, const double& low, const double& high) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::uniform_real_distribution<T> uniform_dist(low, high);
-    ndfunc_t ndf = { _iter_rand<std::uniform_real_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::uniform_real_distribution<T>> opt = { uniform_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+  template<typename T> static void _rand_lognormal(VALUE& self, VALUE& x, const double& mean, const double& sigma) {
+    ziggurat_lognormal_distribution<T> lognormal_dist(mean, sigma);
+    _ndloop_rand<ziggurat_lognormal_distribution<T>, T>(self, x, lognormal_dist);
   }
 
-  static VALUE _numo_random_uniform(int argc, VALUE* argv, VALUE self) {
+  static VALUE _numo_random_lognormal(int argc, VALUE* argv, VALUE self) {
     VALUE x = Qnil;
     VALUE kw_args = Qnil;
-    ID kw_table[2] = { rb_intern("low"), rb_intern("high") };
+    ID kw_table[2] = { rb_intern("mean"), rb_intern("sigma") };
     VALUE kw_values[2] = { Qundef, Qundef };
     rb_scan_args(argc, argv, "1:", &x, &kw_args);
     rb_get_kwargs(kw_args, kw_table, 0, 2, kw_values);
 
-    VALUE klass = rb_obj_class(x);
+    const VALUE klass = rb_obj_class(x);
     if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
 
-    const double low = kw_values[0] == Qundef ? 0.0 : NUM2DBL(kw_values[0]);
-    const double high = kw_values[1] == Qundef ? 1.0 : NUM2DBL(kw_values[1]);
-    if (high - low < 0) rb_raise(rb_eArgError, "high - low must be > 0");
+    if (_has_param_array(kw_values, 2)) {
+      const double defaults[2] = { 0.0, 1.0 };
+      VALUE params[2];
+      _cast_params(x, kw_table, kw_values, defaults, 2, params);
+      _check_params<2>(params, [](const double* v) { return !(v[1] >= 0); }, "sigma must be a non-negative value");
+      _rand_param_float<ziggurat_lognormal_distribution, 2>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
+    const double mean = kw_values[0] == Qundef ? 0.0 : NUM2DBL(kw_values[0]);
+    const double sigma = kw_values[1] == Qundef ? 1.0 : NUM2DBL(kw_values[1]);
+    if (sigma < 0) rb_raise(rb_eArgError, "sigma must be a non-negative value");
 
     if (klass == numo_cSFloat) {
-      _rand_uniform<float>(self, x, low, high);
+      _rand_lognormal<float>(self, x, mean, sigma);
     } else {
-      _rand_uniform<double>(self, x, low, high);
+      _rand_lognormal<double>(self, x, mean, sigma);
     }
 
     RB_GC_GUARD(x);
     return Qnil;
   }
 
-  // #cauchy
+  // #standard_t
 
-  template<typename T> static void _rand_cauchy(VALUE& self, VALUE& x, const double& loc, const double& scale) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::cauchy_distribution<T> cauchy_dist(loc, scale);
-    ndfunc_t ndf = { _iter_rand<std::cauchy_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::cauchy_distribution<T>> opt = { cauchy_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+  template<typename T> static void _rand_t(VALUE& self, VALUE& x, const double& df) {
+    marsaglia_tsang_student_t_distribution<T> t_dist(df);
+    _ndloop_rand<marsaglia_tsang_student_t_distribution<T>, T>(self, x, t_dist);
   }
 
-  static VALUE _numo_random_cauchy(int argc, VALUE* argv, VALUE self) {
+  static VALUE _numo_random_standard_t(int argc, VALUE* argv, VALUE self) {
     VALUE x = Qnil;
     VALUE kw_args = Qnil;
-    ID kw_table[2] = { rb_intern("loc"), rb_intern("scale") };
-    VALUE kw_values[2] = { Qundef, Qundef };
+    ID kw_table[1] = { rb_intern("df") };
+    VALUE kw_values[1] = { Qundef };
     rb_scan_args(argc, argv, "1:", &x, &kw_args);
-    rb_get_kwargs(kw_args, kw_table, 0, 2, kw_values);
+    rb_get_kwargs(kw_args, kw_table, 1, 0, kw_values);
 
     const VALUE klass = rb_obj_class(x);
     if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
 
-    const double loc = kw_values[0] == Qundef ? 0.0 : NUM2DBL(kw_values[0]);
-    const double scale = kw_values[1] == Qundef ? 1.0 : NUM2DBL(kw_values[1]);
-    if (scale < 0) rb_raise(rb_eArgError, "scale must be a non-negative value");
+    if (_has_param_array(kw_values, 1)) {
+      const double defaults[1] = { 0.0 };
+      VALUE params[1];
+      _cast_params(x, kw_table, kw_values, defaults, 1, params);
+      _check_params<1>(params, [](const double* v) { return !(v[0] > 0); }, "df must be > 0");
+      _rand_param_float<marsaglia_tsang_student_t_distribution, 1>(self, x, klass, params);
+      RB_GC_GUARD(x);
+      return Qnil;
+    }
+
+    const double df = NUM2DBL(kw_values[0]);
+    if (df <= 0) rb_raise(rb_eArgError, "df must be > 0");
 
     if (klass == numo_cSFloat) {
-      _rand_cauchy<float>(self, x, loc, scale);
+      _rand_t<float>(self, x, df);
     } else {
-      _rand_cauchy<double>(self, x, loc, scale);
+      _rand_t<double>(self, x, df);
     }
 
     RB_GC_GUARD(x);
     return Qnil;
   }
 
-  // #chisqure
+  // #shuffle
 
-  template<typename T> static void _rand_chisquare(VALUE& self, VALUE& x, const double& df) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::chi_squared_distribution<T> chisquare_dist(df);
-    ndfunc_t ndf = { _iter_rand<std::chi_squared_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::chi_squared_distribution<T>> opt = { chisquare_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+  struct shuffle_opt_t {
+    Rng* rnd;
+    char* ptr;
+    size_t n_blocks;
+    size_t n_rows;
+    size_t row_bits;
+    bool bit;
+  };
+
+  static void _swap_rows(char* a, char* b, const size_t row_size) {
+    switch (row_size) {
+    case 1:
+      std::swap(*(uint8_t*)a, *(uint8_t*)b);
+      break;
+    case 2:
+      std::swap(*(uint16_t*)a, *(uint16_t*)b);
+      break;
+    case 4:
+      std::swap(*(uint32_t*)a, *(uint32_t*)b);
+      break;
+    case 8:
+      std::swap(*(uint64_t*)a, *(uint64_t*)b);
+      break;
+    default:
+      std::swap_ranges(a, a + row_size, b);
+    }
   }
 
-  static VALUE _numo_random_chisquare(int argc, VALUE* argv, VALUE self) {
+  static void _swap_bit_rows(BIT_DIGIT* a, const size_t pos_a, const size_t pos_b, const size_t row_bits) {
+    for (size_t k = 0; k < row_bits; k++) {
+      BIT_DIGIT bit_a;
+      BIT_DIGIT bit_b;
+      LOAD_BIT(a, pos_a + k, bit_a);
+      LOAD_BIT(a, pos_b + k, bit_b);
+      STORE_BIT(a, pos_a + k, bit_b);
+      STORE_BIT(a, pos_b + k, bit_a);
+    }
+  }
+
+  // Shuffles the rows, which are the subarrays along the axis, with the Fisher-Yates algorithm.
+  // The rows are swapped at once in every block over the preceding axes, so that they are shuffled in the same order.
+  static void* _shuffle_rows(void* ptr) {
+    shuffle_opt_t* opt = (shuffle_opt_t*)ptr;
+    Rng& rng = *(opt->rnd);
+    const size_t row_size = opt->row_bits / 8;
+    for (size_t i = opt->n_rows - 1; i > 0; i--) {
+      if (i % NUMO_RANDOM_CANCEL_BLOCK == 0 && rng_cancelled()) return NULL;
+      const size_t j = (size_t)next_bounded_uint64(rng, i);
+      if (i == j) continue;
+      for (size_t b = 0; b < opt->n_blocks; b++) {
+        const size_t offset = b * opt->n_rows;
+        if (opt->bit) {
+          _swap_bit_rows((BIT_DIGIT*)opt->ptr, (offset + i) * opt->row_bits, (offset + j) * opt->row_bits, opt->row_bits);
+        } else {
+          _swap_rows(opt->ptr + (offset + i) * row_size, opt->ptr + (offset + j) * row_size, row_size);
+        }
+      }
+    }
+    return NULL;
+  }
+
+  static VALUE _numo_random_shuffle(int argc, VALUE* argv, VALUE self) {
     VALUE x = Qnil;
     VALUE kw_args = Qnil;
-    ID kw_table[1] = { rb_intern("df") };
+    ID kw_table[1] = { rb_intern("axis") };
     VALUE kw_values[1] = { Qundef };
     rb_scan_args(argc, argv, "1:", &x, &kw_args);
-    rb_get_kwargs(kw_args, kw_table, 1, 0, kw_values);
+    rb_get_kwargs(kw_args, kw_table, 0, 1, kw_values);
 
+    if (!IsNArray(x)) rb_raise(rb_eTypeError, "x must be Numo::NArray");
+    narray_t* x_na;
+    GetNArray(x, x_na);
+    const int ndim = NA_NDIM(x_na);
+    if (ndim < 1) rb_raise(rb_eArgError, "x must have at least one dimension");
+    int axis = kw_values[0] == Qundef ? 0 : NUM2INT(kw_values[0]);
+    if (axis < -ndim || axis >= ndim) rb_raise(rb_eArgError, "axis must be >= %d and < %d", -ndim, ndim);
+    if (axis < 0) axis += ndim;
+    if (NA_SIZE(x_na) == 0) return Qnil;
+
+    // The rows are swapped in place if x is contiguous, and otherwise in a contiguous copy that is stored back to x.
+    // A bit array is always copied, since its view can begin in the middle of a digit.
+    // The pointer to the data begins at the parent array of a view, so the offset of the view is added to it.
     const VALUE klass = rb_obj_class(x);
-    if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
+    const size_t elm_bits = NUM2SIZET(rb_const_get(klass, rb_intern("ELEMENT_BIT_SIZE")));
+    const bool bit = klass == numo_cBit;
+    VALUE y = (bit || !RTEST(nary_check_contiguous(x))) ? nary_dup(x) : x;
 
-    const double df = NUM2DBL(kw_values[0]);
-    if (df <= 0) rb_raise(rb_eArgError, "df must be > 0");
+    shuffle_opt_t opt = { get_rng(self), na_get_pointer_for_read_write(y) + na_get_offset(y), 1, NA_SHAPE(x_na)[axis], elm_bits, bit };
+    for (int d = 0; d < axis; d++) opt.n_blocks *= NA_SHAPE(x_na)[d];
+    for (int d = axis + 1; d < ndim; d++) opt.row_bits *= NA_SHAPE(x_na)[d];
+    _call_rng(rb_iv_get(self, "lock"), NA_SIZE(x_na), _shuffle_rows, &opt);
 
-    if (klass == numo_cSFloat) {
-      _rand_chisquare<float>(self, x, df);
-    } else {
-      _rand_chisquare<double>(self, x, df);
+    if (y != x) rb_funcall(x, rb_intern("store"), 1, y);
+
+    RB_GC_GUARD(y);
+    RB_GC_GUARD(x);
+    return Qnil;
+  }
+
+  // #permutation
+
+  template<typename T> struct permutation_opt_t {
+    Rng* rnd;
+    T* ptr;
+    size_t n;
+  };
+
+  // Writes a random permutation of 0, 1, ..., n - 1 with the inside-out version of the Fisher-Yates algorithm.
+  template<typename T> static void* _fill_permutation(void* ptr) {
+    permutation_opt_t<T>* opt = (permutation_opt_t<T>*)ptr;
+    Rng& rng = *(opt->rnd);
+    T* a = opt->ptr;
+    for (size_t i = 0; i < opt->n; i++) {
+      if (i % NUMO_RANDOM_CANCEL_BLOCK == 0 && rng_cancelled()) return NULL;
+      const size_t j = (size_t)next_bounded_uint64(rng, i);
+      if (j != i) a[i] = a[j];
+      a[j] = (T)i;
+    }
+    return NULL;
+  }
+
+  template<typename T> static void _rand_permutation(VALUE& self, VALUE& x) {
+    narray_t* x_na;
+    GetNArray(x, x_na);
+    const size_t n = NA_SIZE(x_na);
+    if (n > 0 && (uint64_t)(n - 1) > (uint64_t)std::numeric_limits<T>::max()) {
+      rb_raise(rb_eArgError, "size of array must be within the range of the array type");
+    }
+
+    VALUE y = RTEST(nary_check_contiguous(x)) ? x : nary_dup(x);
+    permutation_opt_t<T> opt = { get_rng(self), (T*)(na_get_pointer_for_write(y) + na_get_offset(y)), n };
+    _call_rng(rb_iv_get(self, "lock"), n, _fill_permutation<T>, &opt);
+    if (y != x) rb_funcall(x, rb_intern("store"), 1, y);
+    RB_GC_GUARD(y);
+  }
+
+  static VALUE _numo_random_permutation(VALUE self, VALUE x) {
+    const VALUE klass = rb_obj_class(x);
+    if (klass != numo_cInt8 && klass != numo_cInt16 && klass != numo_cInt32 && klass != numo_cInt64
+        && klass != numo_cUInt8 && klass != numo_cUInt16 && klass != numo_cUInt32 && klass != numo_cUInt64)
+      rb_raise(rb_eTypeError, "invalid NArray class, it must be integer typed array");
+
+    if (klass == numo_cInt8) {
+      _rand_permutation<int8_t>(self, x);
+    } else if (klass == numo_cInt16) {
+      _rand_permutation<int16_t>(self, x);
+    } else if (klass == numo_cInt32) {
+      _rand_permutation<int32_t>(self, x);
+    } else if (klass == numo_cInt64) {
+      _rand_permutation<int64_t>(self, x);
+    } else if (klass == numo_cUInt8) {
+      _rand_permutation<uint8_t>(self, x);
+    } else if (klass == numo_cUInt16) {
+      _rand_permutation<uint16_t>(self, x);
+    } else if (klass == numo_cUInt32) {
+      _rand_permutation<uint32_t>(self, x);
+    } else if (klass == numo_cUInt64) {
+      _rand_permutation<uint64_t>(self, x);
     }
 
     RB_GC_GUARD(x);
     return Qnil;
   }
 
-  // #f
+  // #choice
+
+  template<typename T> struct choice_opt_t {
+    Rng* rnd;
+    T* ptr;
+    size_t k;
+    uint64_t n;
+    std::vector<T>* pool;
+    std::unordered_set<uint64_t>* drawn;
+  };
+
+  // Samples k distinct indices with the Fisher-Yates algorithm stopped after k steps on the array of all n indices.
+  template<typename T> static void* _choice_fisher_yates(void* ptr) {
+    choice_opt_t<T>* opt = (choice_opt_t<T>*)ptr;
+    Rng& rng = *(opt->rnd);
+    std::vector<T>& pool = *(opt->pool);
+    for (size_t i = 0; i < pool.size(); i++) pool[i] = (T)i;
+    for (size_t i = 0; i < opt->k; i++) {
+      if (i % NUMO_RANDOM_CANCEL_BLOCK == 0 && rng_cancelled()) return NULL;
+      const size_t j = i + (size_t)next_bounded_uint64(rng, opt->n - 1 - i);
+      std::swap(pool[i], pool[j]);
+      opt->ptr[i] = pool[i];
+    }
+    return NULL;
+  }
+
+  // Samples k distinct indices with Floyd's algorithm in O(k) time and memory. Since Floyd's algorithm does not
+  // draw the indices in random order, they are shuffled afterwards.
+  template<typename T> static void* _choice_floyd(void* ptr) {
+    choice_opt_t<T>* opt = (choice_opt_t<T>*)ptr;
+    Rng& rng = *(opt->rnd);
+    std::unordered_set<uint64_t>& drawn = *(opt->drawn);
+    drawn.clear();
+    size_t i = 0;
+    for (uint64_t j = opt->n - opt->k; j < opt->n; j++) {
+      if (i % NUMO_RANDOM_CANCEL_BLOCK == 0 && rng_cancelled()) return NULL;
+      uint64_t v = next_bounded_uint64(rng, j);
+      if (!drawn.insert(v).second) {
+        v = j;
+        drawn.insert(j);
+      }
+      opt->ptr[i++] = (T)v;
+    }
+    for (size_t s = opt->k - 1; s > 0; s--) std::swap(opt->ptr[s], opt->ptr[(size_t)next_bounded_uint64(rng, s)]);
+    return NULL;
+  }
+
+  template<typename T, typename P> struct choice_weighted_opt_t {
+    Rng* rnd;
+    T* ptr;
+    size_t k;
+    size_t n;
+    const P* weight;
+    std::vector<std::pair<double, T> >* keys;
+  };
+
+  // Samples k distinct indices with probabilities proportional to the weights with the exponential-key method of
+  // Efraimidis and Spirakis. The indices of the k smallest keys E / w, where E is a standard exponential random number,
+  // are distributed as k successive draws without replacement when they are sorted in ascending order of the keys.
+  template<typename T, typename P> static void* _choice_weighted(void* ptr) {
+    choice_weighted_opt_t<T, P>* opt = (choice_weighted_opt_t<T, P>*)ptr;
+    Rng& rng = *(opt->rnd);
+    std::vector<std::pair<double, T> >& keys = *(opt->keys);
+    keys.clear();
+    for (size_t i = 0; i < opt->n; i++) {
+      if (i % NUMO_RANDOM_CANCEL_BLOCK == 0 && rng_cancelled()) return NULL;
+      if (opt->weight[i] > 0) keys.push_back(std::make_pair(ziggurat_standard_exponential(rng) / opt->weight[i], (T)i));
+    }
+    std::nth_element(keys.begin(), keys.begin() + (opt->k - 1), keys.end());
+    std::sort(keys.begin(), keys.begin() + opt->k);
+    for (size_t i = 0; i < opt->k; i++) opt->ptr[i] = keys[i].second;
+    return NULL;
+  }
+
+  template<typename T, typename P> static void _rand_choice_weighted(VALUE& self, T* ptr, const size_t k, const VALUE& w) {
+    narray_t* w_nary;
+    GetNArray(w, w_nary);
+    const size_t n = NA_SIZE(w_nary);
+    std::vector<std::pair<double, T> > keys;
+    keys.reserve(n);
+    choice_weighted_opt_t<T, P> opt = { get_rng(self), ptr, k, n, (const P*)na_get_pointer_for_read(w), &keys };
+    _call_rng(rb_iv_get(self, "lock"), n, _choice_weighted<T, P>, &opt);
+  }
+
+  template<typename T> static void _rand_choice(VALUE& self, VALUE& x, const uint64_t n, const bool replace, VALUE& w) {
+    if (n - 1 > (uint64_t)std::numeric_limits<T>::max()) rb_raise(rb_eArgError, "n must be within the range of the array type");
+
+    if (replace) {
+      if (NIL_P(w)) {
+        lemire_uniform_int_distribution<T> integers_dist(0, n - 1);
+        _ndloop_rand<lemire_uniform_int_distribution<T>, T>(self, x, integers_dist);
+      } else if (RbNumoRandomAliasTable::is_alias_table(w)) {
+        _rand_discrete<T>(self, x, *RbNumoRandomAliasTable::get_alias_table(w));
+      } else {
+        alias_table table;
+        RbNumoRandomAliasTable::build_alias_table(w, table);
+        _rand_discrete<T>(self, x, table);
+      }
+      return;
+    }
 
-  template<typename T> static void _rand_f(VALUE& self, VALUE& x, const double& dfnum, const double& dfden) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::fisher_f_distribution<T> f_dist(dfnum, dfden);
-    ndfunc_t ndf = { _iter_rand<std::fisher_f_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::fisher_f_distribution<T>> opt = { f_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+    narray_t* x_na;
+    GetNArray(x, x_na);
+    const size_t k = NA_SIZE(x_na);
+    if (k == 0) return;
+    VALUE y = RTEST(nary_check_contiguous(x)) ? x : nary_dup(x);
+    T* ptr = (T*)(na_get_pointer_for_write(y) + na_get_offset(y));
+    if (!NIL_P(w)) {
+      if (rb_obj_class(w) == numo_cSFloat) {
+        _rand_choice_weighted<T, float>(self, ptr, k, w);
+      } else {
+        _rand_choice_weighted<T, double>(self, ptr, k, w);
+      }
+    } else if (n / 32 < k) {
+      // the array of all indices is small enough compared to the sample.
+      std::vector<T> pool(n);
+      choice_opt_t<T> opt = { get_rng(self), ptr, k, n, &pool, NULL };
+      _call_rng(rb_iv_get(self, "lock"), n, _choice_fisher_yates<T>, &opt);
+    } else {
+      std::unordered_set<uint64_t> drawn;
+      drawn.reserve(k);
+      choice_opt_t<T> opt = { get_rng(self), ptr, k, n, NULL, &drawn };
+      _call_rng(rb_iv_get(self, "lock"), k, _choice_floyd<T>, &opt);
+    }
+    if (y != x) rb_funcall(x, rb_intern("store"), 1, y);
+    RB_GC_GUARD(y);
   }
 
-  static VALUE _numo_random_f(int argc, VALUE* argv, VALUE self) {
+  static VALUE _numo_random_choice(int argc, VALUE* argv, VALUE self) {
     VALUE x = Qnil;
     VALUE kw_args = Qnil;
-    ID kw_table[2] = { rb_intern("dfnum"), rb_intern("dfden") };
-    VALUE kw_values[2] = { Qundef, Qundef };
+    ID kw_table[3] = { rb_intern("n"), rb_intern("replace"), rb_intern("weight") };
+    VALUE kw_values[3] = { Qundef, Qundef, Qundef };
     rb_scan_args(argc, argv, "1:", &x, &kw_args);
-    rb_get_kwargs(kw_args, kw_table, 2, 0, kw_values);
+    rb_get_kwargs(kw_args, kw_table, 1, 2, kw_values);
 
     const VALUE klass = rb_obj_class(x);
-    if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
+    if (klass != numo_cInt8 && klass != numo_cInt16 && klass != numo_cInt32 && klass != numo_cInt64
+        && klass != numo_cUInt8 && klass != numo_cUInt16 && klass != numo_cUInt32 && klass != numo_cUInt64)
+      rb_raise(rb_eTypeError, "invalid NArray class, it must be integer typed array");
 
-    const double dfnum = NUM2DBL(kw_values[0]);
-    const double dfden = NUM2DBL(kw_values[1]);
-    if (dfnum <= 0) rb_raise(rb_eArgError, "dfnum must be > 0");
-    if (dfden <= 0) rb_raise(rb_eArgError, "dfden must be > 0");
+    VALUE n_val = kw_values[0];
+    if (!RB_INTEGER_TYPE_P(n_val)) rb_raise(rb_eTypeError, "n must be Integer");
+    if (!RTEST(rb_funcall(n_val, '>', 1, INT2FIX(0)))) rb_raise(rb_eArgError, "n must be > 0");
+    const uint64_t n = NUM2ULL(n_val);
+    const bool replace = kw_values[1] == Qundef ? true : RTEST(kw_values[1]);
+    narray_t* x_na;
+    GetNArray(x, x_na);
+    const size_t k = NA_SIZE(x_na);
+    if (!replace && k > n) rb_raise(rb_eArgError, "size of array must be <= n when replace is false");
+
+    // All the checks of the weight are done here, before any buffer for sampling is allocated.
+    VALUE w = kw_values[2] == Qundef ? Qnil : kw_values[2];
+    if (replace && RbNumoRandomAliasTable::is_alias_table(w)) {
+      const size_t w_len = RbNumoRandomAliasTable::get_alias_table(w)->size();
+      if (w_len < 1) rb_raise(rb_eArgError, "alias table is not initialized");
+      if (w_len != n) rb_raise(rb_eArgError, "length of weight must be equal to n");
+    } else if (!NIL_P(w)) {
+      w = RbNumoRandomAliasTable::get_weight_array(w);
+      narray_t* w_nary;
+      GetNArray(w, w_nary);
+      const size_t w_len = NA_SIZE(w_nary);
+      if (w_len != n) rb_raise(rb_eArgError, "length of weight must be equal to n");
+      const size_t n_positive = rb_obj_class(w) == numo_cSFloat
+                                  ? RbNumoRandomAliasTable::check_weight((float*)na_get_pointer_for_read(w), w_len)
+                                  : RbNumoRandomAliasTable::check_weight((double*)na_get_pointer_for_read(w), w_len);
+      if (!replace && n_positive < k) rb_raise(rb_eArgError, "number of positive weights must be >= size of array");
+    }
 
-    if (klass == numo_cSFloat) {
-      _rand_f<float>(self, x, dfnum, dfden);
-    } else {
-      _rand_f<double>(self, x, dfnum, dfden);
+    if (klass == numo_cInt8) {
+      _rand_choice<int8_t>(self, x, n, replace, w);
+    } else if (klass == numo_cInt16) {
+      _rand_choice<int16_t>(self, x, n, replace, w);
+    } else if (klass == numo_cInt32) {
+      _rand_choice<int32_t>(self, x, n, replace, w);
+    } else if (klass == numo_cInt64) {
+      _rand_choice<int64_t>(self, x, n, replace, w);
+    } else if (klass == numo_cUInt8) {
+      _rand_choice<uint8_t>(self, x, n, replace, w);
+    } else if (klass == numo_cUInt16) {
+      _rand_choice<uint16_t>(self, x, n, replace, w);
+    } else if (klass == numo_cUInt32) {
+      _rand_choice<uint32_t>(self, x, n, replace, w);
+    } else if (klass == numo_cUInt64) {
+      _rand_choice<uint64_t>(self, x, n, replace, w);
     }
 
+    RB_GC_GUARD(w);
     RB_GC_GUARD(x);
     return Qnil;
   }
+};
 
-  // #normal
-
-  template<typename T> static void _rand_normal(VALUE& self, VALUE& x, const double& loc, const double& scale) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::normal_distribution<T> normal_dist(loc, scale);
-    ndfunc_t ndf = { _iter_rand<std::normal_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::normal_distribution<T>> opt = { normal_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+// pcg_stream<Rng>::value is true if the stream of the PCG engine can be selected, which is not the case with
+// the MCG engines such as pcg64_fast.
+template<class Rng, bool = Rng::can_specify_stream> struct pcg_stream {
+  typedef typename Rng::state_type itype;
+  static const bool value = true;
+  static void init(Rng* ptr, const long seed, const itype stream) {
+    new (ptr) Rng(seed, stream);
+  }
+  static void set_stream(Rng* ptr, const itype stream) {
+    ptr->set_stream(stream);
   }
+  static itype stream(Rng* ptr) {
+    return ptr->stream();
+  }
+};
 
-  static VALUE _numo_random_normal(int argc, VALUE* argv, VALUE self) {
-    VALUE x = Qnil;
-    VALUE kw_args = Qnil;
-    ID kw_table[2] = { rb_intern("loc"), rb_intern("scale") };
-    VALUE kw_values[2] = { Qundef, Qundef };
-    rb_scan_args(argc, argv, "1:", &x, &kw_args);
-    rb_get_kwargs(kw_args, kw_table, 0, 2, kw_values);
+template<class Rng> struct pcg_stream<Rng, false> {
+  typedef typename Rng::state_type itype;
+  static const bool value = false;
+  static void init(Rng*, const long, const itype) {}
+  static void set_stream(Rng*, const itype) {}
+  static itype stream(Rng*) {
+    return 0;
+  }
+};
 
-    VALUE klass = rb_obj_class(x);
-    if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
+template<class Rng, class Impl> class RbNumoRandomPCG : public RbNumoRandom<Rng, Impl> {
+public:
+  typedef typename Rng::state_type itype;
 
-    const double loc = kw_values[0] == Qundef ? 0.0 : NUM2DBL(kw_values[0]);
-    const double scale = kw_values[1] == Qundef ? 1.0 : NUM2DBL(kw_values[1]);
-    if (scale < 0) rb_raise(rb_eArgError, "scale must be a non-negative value");
+  static VALUE define_class(VALUE rb_mNumoRandom, const char* class_name) {
+    VALUE rb_cRng = RbNumoRandom<Rng, Impl>::define_class(rb_mNumoRandom, class_name);
+    rb_define_method(rb_cRng, "advance", RUBY_METHOD_FUNC(_numo_random_advance), 1);
+    rb_define_method(rb_cRng, "backstep", RUBY_METHOD_FUNC(_numo_random_backstep), 1);
+    rb_define_method(rb_cRng, "discard", RUBY_METHOD_FUNC(_numo_random_advance), 1);
+    rb_define_method(rb_cRng, "initialize", RUBY_METHOD_FUNC(_numo_random_init), -1);
+    rb_define_method(rb_cRng, "seed=", RUBY_METHOD_FUNC(_numo_random_set_seed), 1);
+    if (pcg_stream<Rng>::value) rb_define_method(rb_cRng, "stream", RUBY_METHOD_FUNC(_numo_random_get_stream), 0);
+    return rb_cRng;
+  }
 
-    if (klass == numo_cSFloat) {
-      _rand_normal<float>(self, x, loc, scale);
-    } else {
-      _rand_normal<double>(self, x, loc, scale);
+  // Converts Integer to the state type of the engine. The value is reduced modulo 2^(bit width of the state type),
+  // so a negative value means going backwards.
+  static itype num2itype(VALUE num, const char* name) {
+    if (!RB_INTEGER_TYPE_P(num)) rb_raise(rb_eTypeError, "%s must be an Integer", name);
+    const size_t n_words = (sizeof(itype) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    uint64_t words[n_words];
+    rb_integer_pack(num, words, n_words, sizeof(uint64_t), 0, INTEGER_PACK_LSWORD_FIRST | INTEGER_PACK_NATIVE_BYTE_ORDER | INTEGER_PACK_2COMP);
+    itype val = 0;
+    for (size_t i = n_words; i-- > 0;) {
+      // shift in two steps, since shifting a 64-bit integer by 64 bits is undefined.
+      val <<= 32;
+      val <<= 32;
+      val |= itype(words[i]);
     }
-
-    RB_GC_GUARD(x);
-    return Qnil;
+    return val;
   }
 
-  // #lognormal
-
-  template<typename T> static void _rand_lognormal(VALUE& self, VALUE& x, const double& mean, const double& sigma) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::lognormal_distribution<T> lognormal_dist(mean, sigma);
-    ndfunc_t ndf = { _iter_rand<std::lognormal_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::lognormal_distribution<T>> opt = { lognormal_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+  // Converts the state type of the engine to non-negative Integer.
+  static VALUE itype2num(itype val) {
+    const size_t n_words = (sizeof(itype) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    uint64_t words[n_words];
+    for (size_t i = 0; i < n_words; i++) {
+      words[i] = static_cast<uint64_t>(val);
+      val >>= 32;
+      val >>= 32;
+    }
+    return rb_integer_unpack(words, n_words, sizeof(uint64_t), 0, INTEGER_PACK_LSWORD_FIRST | INTEGER_PACK_NATIVE_BYTE_ORDER);
   }
 
-  static VALUE _numo_random_lognormal(int argc, VALUE* argv, VALUE self) {
-    VALUE x = Qnil;
+private:
+  // #initialize
+
+  static VALUE _numo_random_init(int argc, VALUE* argv, VALUE self) {
     VALUE kw_args = Qnil;
-    ID kw_table[2] = { rb_intern("mean"), rb_intern("sigma") };
+    ID kw_table[2] = { rb_intern("seed"), rb_intern("stream") };
     VALUE kw_values[2] = { Qundef, Qundef };
-    rb_scan_args(argc, argv, "1:", &x, &kw_args);
+    rb_scan_args(argc, argv, ":", &kw_args);
     rb_get_kwargs(kw_args, kw_table, 0, 2, kw_values);
+    VALUE seed = kw_values[0] == Qundef || NIL_P(kw_values[0]) ? RbNumoRandomSeedSequence::new_seed_seq() : kw_values[0];
+    VALUE stream = kw_values[1] == Qundef ? Qnil : kw_values[1];
+    if (!NIL_P(stream) && !pcg_stream<Rng>::value) rb_raise(rb_eArgError, "stream is not available with %s", rb_class2name(rb_obj_class(self)));
+    if (!NIL_P(stream)) num2itype(stream, "stream");
+    rb_iv_set(self, "stream", stream);
+    init_pcg(self, seed);
+    rb_iv_set(self, "seed", seed);
+    return Qnil;
+  }
 
-    const VALUE klass = rb_obj_class(x);
-    if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
+  // #seed=
 
-    const double mean = kw_values[0] == Qundef ? 0.0 : NUM2DBL(kw_values[0]);
-    const double sigma = kw_values[1] == Qundef ? 1.0 : NUM2DBL(kw_values[1]);
-    if (sigma < 0) rb_raise(rb_eArgError, "sigma must be a non-negative value");
+  static VALUE _numo_random_set_seed(VALUE self, VALUE seed) {
+    init_pcg(self, seed);
+    rb_iv_set(self, "seed", seed);
+    return Qnil;
+  }
 
-    if (klass == numo_cSFloat) {
-      _rand_lognormal<float>(self, x, mean, sigma);
+  // Initializes the engine with the seed, keeping the stream if it was given to the constructor.
+  static void init_pcg(VALUE self, VALUE seed) {
+    Rng* ptr = RbNumoRandom<Rng, Impl>::get_rng(self);
+    VALUE stream = rb_iv_get(self, "stream");
+    if (NIL_P(stream)) {
+      RbNumoRandom<Rng, Impl>::init_rng(ptr, seed);
+    } else if (RbNumoRandomSeedSequence::is_seed_seq(seed)) {
+      RbNumoRandom<Rng, Impl>::init_rng(ptr, seed);
+      pcg_stream<Rng>::set_stream(ptr, num2itype(stream, "stream"));
     } else {
-      _rand_lognormal<double>(self, x, mean, sigma);
+      pcg_stream<Rng>::init(ptr, NUM2LONG(seed), num2itype(stream, "stream"));
     }
-
-    RB_GC_GUARD(x);
-    return Qnil;
   }
 
-  // #standard_t
+  // #stream
 
-  template<typename T> static void _rand_t(VALUE& self, VALUE& x, const double& df) {
-    Rng* ptr = get_rng(self);
-    ndfunc_arg_in_t ain[1] = { { OVERWRITE, 0 } };
-    std::student_t_distribution<T> t_dist(df);
-    ndfunc_t ndf = { _iter_rand<std::student_t_distribution<T>, T>, FULL_LOOP, 1, 0, ain, 0 };
-    rand_opt_t<std::student_t_distribution<T>> opt = { t_dist, ptr };
-    na_ndloop3(&ndf, &opt, 1, x);
+  static VALUE _numo_random_get_stream(VALUE self) {
+    return itype2num(pcg_stream<Rng>::stream(RbNumoRandom<Rng, Impl>::get_rng(self)));
   }
 
-  static VALUE _numo_random_standard_t(int argc, VALUE* argv, VALUE self) {
-    VALUE x = Qnil;
-    VALUE kw_args = Qnil;
-    ID kw_table[1] = { rb_intern("df") };
-    VALUE kw_values[1] = { Qundef };
-    rb_scan_args(argc, argv, "1:", &x, &kw_args);
-    rb_get_kwargs(kw_args, kw_table, 1, 0, kw_values);
+  // #advance
 
-    const VALUE klass = rb_obj_class(x);
-    if (klass != numo_cSFloat && klass != numo_cDFloat) rb_raise(rb_eTypeError, "invalid NArray class, it must be DFloat or SFloat");
+  static VALUE _numo_random_advance(VALUE self, VALUE delta) {
+    move_pcg(self, delta, true);
+    return Qnil;
+  }
 
-    const double df = NUM2DBL(kw_values[0]);
-    if (df <= 0) rb_raise(rb_eArgError, "df must be > 0");
+  // #backstep
 
-    if (klass == numo_cSFloat) {
-      _rand_t<float>(self, x, df);
+  static VALUE _numo_random_backstep(VALUE self, VALUE delta) {
+    move_pcg(self, delta, false);
+    return Qnil;
+  }
+
+  // Moves the engine by delta steps. A negative delta is turned into a step in the opposite direction
+  // instead of being reduced modulo 2^(bit width of the state type), since the period of the extended engines
+  // such as pcg64_k1024 is longer than that.
+  static void move_pcg(VALUE self, VALUE delta, bool forwards) {
+    if (!RB_INTEGER_TYPE_P(delta)) rb_raise(rb_eTypeError, "delta must be an Integer");
+    if (RTEST(rb_funcall(delta, rb_intern("negative?"), 0))) {
+      delta = rb_funcall(delta, rb_intern("-@"), 0);
+      forwards = !forwards;
+    }
+    const itype d = num2itype(delta, "delta");
+    Rng* ptr = RbNumoRandom<Rng, Impl>::get_rng(self);
+    if (forwards) {
+      ptr->advance(d);
     } else {
-      _rand_t<double>(self, x, df);
+      ptr->backstep(d);
     }
-
-    RB_GC_GUARD(x);
-    return Qnil;
   }
 };
 
-class RbNumoRandomPCG32 : public RbNumoRandom<pcg32, RbNumoRandomPCG32> {
+class RbNumoRandomPCG32 : public RbNumoRandomPCG<pcg32, RbNumoRandomPCG32> {
 public:
   static const rb_data_type_t rng_type;
 };
@@ -850,7 +2605,7 @@ const rb_data_type_t RbNumoRandomPCG32::rng_type = {
   0
 };
 
-class RbNumoRandomPCG64 : public RbNumoRandom<pcg64, RbNumoRandomPCG64> {
+class RbNumoRandomPCG64 : public RbNumoRandomPCG<pcg64, RbNumoRandomPCG64> {
 public:
   static const rb_data_type_t rng_type;
 };
@@ -867,7 +2622,73 @@ const rb_data_type_t RbNumoRandomPCG64::rng_type = {
   0
 };
 
-class RbNumoRandomMT32 : public RbNumoRandom<std::mt19937, RbNumoRandomMT32> {
+class RbNumoRandomPCG64Fast : public RbNumoRandomPCG<pcg64_fast, RbNumoRandomPCG64Fast> {
+public:
+  static const rb_data_type_t rng_type;
+};
+
+const rb_data_type_t RbNumoRandomPCG64Fast::rng_type = {
+  "RbNumoRandomPCG64Fast",
+  {
+    NULL,
+    RbNumoRandomPCG64Fast::numo_random_free,
+    RbNumoRandomPCG64Fast::numo_random_size
+  },
+  NULL,
+  NULL,
+  0
+};
+
+class RbNumoRandomPCG64K1024 : public RbNumoRandomPCG<pcg64_k1024, RbNumoRandomPCG64K1024> {
+public:
+  static const rb_data_type_t rng_type;
+};
+
+const rb_data_type_t RbNumoRandomPCG64K1024::rng_type = {
+  "RbNumoRandomPCG64K1024",
+  {
+    NULL,
+    RbNumoRandomPCG64K1024::numo_random_free,
+    RbNumoRandomPCG64K1024::numo_random_size
+  },
+  NULL,
+  NULL,
+  0
+};
+
+template<class Rng, class Impl> class RbNumoRandomMT : public RbNumoRandom<Rng, Impl> {
+public:
+  static VALUE define_class(VALUE rb_mNumoRandom, const char* class_name) {
+    VALUE rb_cRng = RbNumoRandom<Rng, Impl>::define_class(rb_mNumoRandom, class_name);
+    rb_define_method(rb_cRng, "jump", RUBY_METHOD_FUNC(_numo_random_jump), -1);
+    rb_define_method(rb_cRng, "jumped", RUBY_METHOD_FUNC(_numo_random_jumped), -1);
+    return rb_cRng;
+  }
+
+private:
+  // #jump
+
+  static VALUE _numo_random_jump(int argc, VALUE* argv, VALUE self) {
+    VALUE n = Qnil;
+    rb_scan_args(argc, argv, "01", &n);
+    const long n_jumps = NIL_P(n) ? 1 : NUM2LONG(n);
+    if (n_jumps < 0) rb_raise(rb_eArgError, "n must be a non-negative value");
+
+    Rng* ptr = RbNumoRandom<Rng, Impl>::get_rng(self);
+    for (long i = 0; i < n_jumps; i++) mt_jump(*ptr);
+    return Qnil;
+  }
+
+  // #jumped
+
+  static VALUE _numo_random_jumped(int argc, VALUE* argv, VALUE self) {
+    VALUE rng = rb_obj_dup(self);
+    _numo_random_jump(argc, argv, rng);
+    return rng;
+  }
+};
+
+class RbNumoRandomMT32 : public RbNumoRandomMT<std::mt19937, RbNumoRandomMT32> {
 public:
   static const rb_data_type_t rng_type;
 };
@@ -884,7 +2705,7 @@ const rb_data_type_t RbNumoRandomMT32::rng_type = {
   0
 };
 
-class RbNumoRandomMT64 : public RbNumoRandom<std::mt19937_64, RbNumoRandomMT64> {
+class RbNumoRandomMT64 : public RbNumoRandomMT<std::mt19937_64, RbNumoRandomMT64> {
 public:
   static const rb_data_type_t rng_type;
 };
@@ -901,4 +2722,148 @@ const rb_data_type_t RbNumoRandomMT64::rng_type = {
   0
 };
 
+template<class Rng, class Impl> class RbNumoRandomXoshiro : public RbNumoRandom<Rng, Impl> {
+public:
+  static VALUE define_class(VALUE rb_mNumoRandom, const char* class_name) {
+    VALUE rb_cRng = RbNumoRandom<Rng, Impl>::define_class(rb_mNumoRandom, class_name);
+    rb_define_method(rb_cRng, "jump", RUBY_METHOD_FUNC(_numo_random_jump), -1);
+    rb_define_method(rb_cRng, "jumped", RUBY_METHOD_FUNC(_numo_random_jumped), -1);
+    rb_define_method(rb_cRng, "long_jump", RUBY_METHOD_FUNC(_numo_random_long_jump), -1);
+    return rb_cRng;
+  }
+
+private:
+  static long get_n_jumps(int argc, VALUE* argv) {
+    VALUE n = Qnil;
+    rb_scan_args(argc, argv, "01", &n);
+    const long n_jumps = NIL_P(n) ? 1 : NUM2LONG(n);
+    if (n_jumps < 0) rb_raise(rb_eArgError, "n must be a non-negative value");
+    return n_jumps;
+  }
+
+  // #jump
+
+  static VALUE _numo_random_jump(int argc, VALUE* argv, VALUE self) {
+    const long n_jumps = get_n_jumps(argc, argv);
+    Rng* ptr = RbNumoRandom<Rng, Impl>::get_rng(self);
+    for (long i = 0; i < n_jumps; i++) ptr->jump();
+    return Qnil;
+  }
+
+  // #jumped
+
+  static VALUE _numo_random_jumped(int argc, VALUE* argv, VALUE self) {
+    VALUE rng = rb_obj_dup(self);
+    _numo_random_jump(argc, argv, rng);
+    return rng;
+  }
+
+  // #long_jump
+
+  static VALUE _numo_random_long_jump(int argc, VALUE* argv, VALUE self) {
+    const long n_jumps = get_n_jumps(argc, argv);
+    Rng* ptr = RbNumoRandom<Rng, Impl>::get_rng(self);
+    for (long i = 0; i < n_jumps; i++) ptr->long_jump();
+    return Qnil;
+  }
+};
+
+class RbNumoRandomXoshiro256 : public RbNumoRandomXoshiro<xoshiro256pp, RbNumoRandomXoshiro256> {
+public:
+  static const rb_data_type_t rng_type;
+};
+
+const rb_data_type_t RbNumoRandomXoshiro256::rng_type = {
+  "RbNumoRandomXoshiro256",
+  {
+    NULL,
+    RbNumoRandomXoshiro256::numo_random_free,
+    RbNumoRandomXoshiro256::numo_random_size
+  },
+  NULL,
+  NULL,
+  0
+};
+
+template<class Rng, class Impl> class RbNumoRandomPhilox : public RbNumoRandom<Rng, Impl> {
+public:
+  typedef typename Rng::result_type utype;
+
+  static VALUE define_class(VALUE rb_mNumoRandom, const char* class_name) {
+    VALUE rb_cRng = RbNumoRandom<Rng, Impl>::define_class(rb_mNumoRandom, class_name);
+    rb_define_method(rb_cRng, "advance", RUBY_METHOD_FUNC(_numo_random_advance), 1);
+    rb_define_method(rb_cRng, "discard", RUBY_METHOD_FUNC(_numo_random_advance), 1);
+    return rb_cRng;
+  }
+
+private:
+  // #advance
+
+  static VALUE _numo_random_advance(VALUE self, VALUE delta) {
+    if (!RB_INTEGER_TYPE_P(delta)) rb_raise(rb_eTypeError, "delta must be an Integer");
+    // The position consists of the counter and the index in the block of four words,
+    // so the delta is reduced modulo 2^(4 * bit width + 2).
+    const size_t n_words = Rng::n_words;
+    utype words[Rng::n_words + 1];
+    rb_integer_pack(delta, words, n_words + 1, sizeof(utype), 0,
+                    INTEGER_PACK_LSWORD_FIRST | INTEGER_PACK_NATIVE_BYTE_ORDER | INTEGER_PACK_2COMP);
+    const int digits = std::numeric_limits<utype>::digits;
+    utype delta_blocks[Rng::n_words];
+    for (size_t i = 0; i < n_words; i++) delta_blocks[i] = (words[i] >> 2) | (words[i + 1] << (digits - 2));
+    RbNumoRandom<Rng, Impl>::get_rng(self)->advance(delta_blocks, (size_t)(words[0] & 3));
+    return Qnil;
+  }
+};
+
+class RbNumoRandomPhilox4x32 : public RbNumoRandomPhilox<philox4x32, RbNumoRandomPhilox4x32> {
+public:
+  static const rb_data_type_t rng_type;
+};
+
+const rb_data_type_t RbNumoRandomPhilox4x32::rng_type = {
+  "RbNumoRandomPhilox4x32",
+  {
+    NULL,
+    RbNumoRandomPhilox4x32::numo_random_free,
+    RbNumoRandomPhilox4x32::numo_random_size
+  },
+  NULL,
+  NULL,
+  0
+};
+
+class RbNumoRandomPhilox4x64 : public RbNumoRandomPhilox<philox4x64, RbNumoRandomPhilox4x64> {
+public:
+  static const rb_data_type_t rng_type;
+};
+
+const rb_data_type_t RbNumoRandomPhilox4x64::rng_type = {
+  "RbNumoRandomPhilox4x64",
+  {
+    NULL,
+    RbNumoRandomPhilox4x64::numo_random_free,
+    RbNumoRandomPhilox4x64::numo_random_size
+  },
+  NULL,
+  NULL,
+  0
+};
+
+class RbNumoRandomPCG32x8 : public RbNumoRandom<pcg32x8, RbNumoRandomPCG32x8> {
+public:
+  static const rb_data_type_t rng_type;
+};
+
+const rb_data_type_t RbNumoRandomPCG32x8::rng_type = {
+  "RbNumoRandomPCG32x8",
+  {
+    NULL,
+    RbNumoRandomPCG32x8::numo_random_free,
+    RbNumoRandomPCG32x8::numo_random_size
+  },
+  NULL,
+  NULL,
+  0
+};
+
 #endif /* NUMO_RANDOM_EXT_HPP */
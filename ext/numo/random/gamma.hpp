@@ -0,0 +1,189 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_GAMMA_HPP
+#define NUMO_RANDOM_GAMMA_HPP 1
+
+#include <cmath>
+
+#include "random_bits.hpp"
+#include "ziggurat.hpp"
+
+/**
+ * Sampler of the standard gamma distribution with the method of Marsaglia and Tsang.
+ * The constants derived from the shape are computed once in the constructor. A shape less than one is boosted
+ * by sampling with shape + 1 and multiplying by U^(1 / shape), where U^(1 / shape) is computed as exp(-E / shape)
+ * with E from the Ziggurat exponential sampler. A shape of one is sampled directly by the Ziggurat exponential sampler.
+ */
+class marsaglia_tsang_gamma {
+public:
+  explicit marsaglia_tsang_gamma(const double alpha = 1)
+    : alpha_(alpha), boost_(alpha < 1), d_((alpha < 1 ? alpha + 1 : alpha) - 1.0 / 3.0), c_(1.0 / std::sqrt(9.0 * d_)),
+      inv_alpha_(1.0 / alpha) {}
+
+  double alpha() const {
+    return alpha_;
+  }
+
+  template<class Rng> double operator()(Rng& rng) const {
+    if (alpha_ == 1) return ziggurat_standard_exponential(rng);
+    double x;
+    for (;;) {
+      double z;
+      double v;
+      do {
+        z = ziggurat_standard_normal(rng);
+        v = 1 + c_ * z;
+      } while (v <= 0);
+      v = v * v * v;
+      const double u = next_double(rng);
+      const double zz = z * z;
+      // the squeeze test accepts most of the samples without the logarithms.
+      if (u < 1 - 0.0331 * zz * zz || std::log(u) < 0.5 * zz + d_ * (1 - v + std::log(v))) {
+        x = d_ * v;
+        break;
+      }
+    }
+    if (boost_) x *= std::exp(-ziggurat_standard_exponential(rng) * inv_alpha_);
+    return x;
+  }
+
+private:
+  double alpha_;
+  bool boost_;
+  double d_;
+  double c_;
+  double inv_alpha_;
+};
+
+/**
+ * Gamma distribution sampled with the method of Marsaglia and Tsang.
+ * It has the same interface as std::gamma_distribution.
+ */
+template<typename RealType = double> class marsaglia_tsang_gamma_distribution {
+public:
+  typedef RealType result_type;
+
+  explicit marsaglia_tsang_gamma_distribution(const RealType alpha = 1, const RealType beta = 1) : beta_(beta), gamma_(alpha) {}
+
+  RealType alpha() const {
+    return static_cast<RealType>(gamma_.alpha());
+  }
+
+  RealType beta() const {
+    return beta_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    return static_cast<RealType>(static_cast<double>(beta_) * gamma_(rng));
+  }
+
+private:
+  RealType beta_;
+  marsaglia_tsang_gamma gamma_;
+};
+
+/**
+ * Chi-squared distribution computed as 2 * G, where G follows the gamma distribution with the shape n / 2.
+ * It has the same interface as std::chi_squared_distribution.
+ */
+template<typename RealType = double> class marsaglia_tsang_chi_squared_distribution {
+public:
+  typedef RealType result_type;
+
+  explicit marsaglia_tsang_chi_squared_distribution(const RealType n = 1) : n_(n), gamma_(0.5 * static_cast<double>(n)) {}
+
+  RealType n() const {
+    return n_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    return static_cast<RealType>(2.0 * gamma_(rng));
+  }
+
+private:
+  RealType n_;
+  marsaglia_tsang_gamma gamma_;
+};
+
+/**
+ * Fisher F distribution computed as (G_m * n) / (G_n * m), where G_m and G_n follow the gamma distributions
+ * with the shapes m / 2 and n / 2. It has the same interface as std::fisher_f_distribution.
+ */
+template<typename RealType = double> class marsaglia_tsang_fisher_f_distribution {
+public:
+  typedef RealType result_type;
+
+  explicit marsaglia_tsang_fisher_f_distribution(const RealType m = 1, const RealType n = 1)
+    : m_(m), n_(n), gamma_m_(0.5 * static_cast<double>(m)), gamma_n_(0.5 * static_cast<double>(n)) {}
+
+  RealType m() const {
+    return m_;
+  }
+
+  RealType n() const {
+    return n_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    const double num = gamma_m_(rng) * static_cast<double>(n_);
+    const double den = gamma_n_(rng) * static_cast<double>(m_);
+    return static_cast<RealType>(num / den);
+  }
+
+private:
+  RealType m_;
+  RealType n_;
+  marsaglia_tsang_gamma gamma_m_;
+  marsaglia_tsang_gamma gamma_n_;
+};
+
+/**
+ * Student's t distribution computed as Z * sqrt(n / (2 * G)), where Z follows the standard normal distribution
+ * sampled with the Ziggurat method and G follows the gamma distribution with the shape n / 2.
+ * It has the same interface as std::student_t_distribution.
+ */
+template<typename RealType = double> class marsaglia_tsang_student_t_distribution {
+public:
+  typedef RealType result_type;
+
+  explicit marsaglia_tsang_student_t_distribution(const RealType n = 1) : n_(n), gamma_(0.5 * static_cast<double>(n)) {}
+
+  RealType n() const {
+    return n_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    const double z = ziggurat_standard_normal(rng);
+    return static_cast<RealType>(z * std::sqrt(static_cast<double>(n_) / (2.0 * gamma_(rng))));
+  }
+
+private:
+  RealType n_;
+  marsaglia_tsang_gamma gamma_;
+};
+
+#endif /* NUMO_RANDOM_GAMMA_HPP */
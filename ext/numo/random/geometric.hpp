@@ -0,0 +1,75 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_GEOMETRIC_HPP
+#define NUMO_RANDOM_GEOMETRIC_HPP 1
+
+#include <cmath>
+#include <limits>
+
+#include "random_bits.hpp"
+#include "ziggurat.hpp"
+
+/**
+ * Geometric distribution of the number of failures before the first success. It is sampled by inversion,
+ * floor(E / -log(1 - p)) with a standard exponential random number E = -log(U), so that the time per value
+ * does not grow as p gets small. E is drawn with the Ziggurat method, which evaluates no logarithm in about 98%
+ * of the calls and makes the inversion about twice as fast as taking log(U) for every value. If p >= 0.75,
+ * it is sampled by counting the failed trials instead, which needs fewer than 4/3 uniform random numbers
+ * on average. The reciprocal of -log(1 - p) is computed once in the constructor.
+ * Values beyond the range of the integer type are clamped to its maximum. It has the same interface as
+ * std::geometric_distribution.
+ */
+template<typename IntType = int> class inversion_geometric_distribution {
+public:
+  typedef IntType result_type;
+
+  explicit inversion_geometric_distribution(const double p = 0.5) : p_(p) {
+    use_inversion_ = p < 0.75;
+    scale_ = -1.0 / std::log1p(-p);
+  }
+
+  double p() const {
+    return p_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    return use_inversion_ ? inversion(rng) : search(rng);
+  }
+
+private:
+  double p_;
+  bool use_inversion_;
+  double scale_;
+
+  template<class Rng> IntType inversion(Rng& rng) const {
+    const double x = std::floor(ziggurat_standard_exponential(rng) * scale_);
+    if (x >= static_cast<double>(std::numeric_limits<IntType>::max())) return std::numeric_limits<IntType>::max();
+    return static_cast<IntType>(x);
+  }
+
+  template<class Rng> IntType search(Rng& rng) const {
+    IntType x = 0;
+    while (next_double(rng) >= p_ && x < std::numeric_limits<IntType>::max()) x++;
+    return x;
+  }
+};
+
+#endif /* NUMO_RANDOM_GEOMETRIC_HPP */
@@ -0,0 +1,252 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_MT_JUMP_HPP
+#define NUMO_RANDOM_MT_JUMP_HPP 1
+
+#include <stdint.h>
+
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Coefficients of the jump polynomials x^(2^128) mod p(x), where p(x) is the characteristic polynomial of
+// the state transition of MT19937 and MT19937-64. Bit i of the little-endian 64-bit words is the coefficient of x^i.
+// The characteristic polynomials are obtained by applying the Berlekamp-Massey algorithm to the output sequences.
+static const uint64_t mt19937_jump_poly[312] = {
+  0xb5709ec472de3963ULL, 0xa823f8e588279bb6ULL, 0x041f225926d83e59ULL, 0x8b521777e7fdbb15ULL,
+  0xbf2812d548b5e756ULL, 0x0b4849aae4b0adb9ULL, 0xe96d39ce3e928b83ULL, 0x09eaf2e8af6131d3ULL,
+  0xc1814c7b33548456ULL, 0xfebd07bc893a7c83ULL, 0x5147dcbf01bd8267ULL, 0x9afef574e2a67de6ULL,
+  0xf0d3decab8334d09ULL, 0xd884703b5561fd58ULL, 0xb39b8f42ef5c803bULL, 0xd61cfed320dfb761ULL,
+  0x47416177cf5f3e5bULL, 0x8ea9cfab8e8442e9ULL, 0x60ddf78d585d0ec0ULL, 0xf0f7d60e2c9b8528ULL,
+  0xca3ee37db2bb3bfcULL, 0x870ed96981c9e659ULL, 0xce5248519573a0deULL, 0x73cda5ed77683b94ULL,
+  0xf43b956c56bcfcbcULL, 0xbf04b4001f91de14ULL, 0x1d8598319438c481ULL, 0x9d97aed5ca6ae0a2ULL,
+  0xe75c95199e464218ULL, 0xcd43455c253c5486ULL, 0x7f8282d473b5ccd8ULL, 0x192ddf99c8cacd44ULL,
+  0x5288b589d6be8546ULL, 0x9819557fb4f26ca7ULL, 0x03e73d28200570ebULL, 0x78a114c9264acc04ULL,
+  0x42eee89795f0fb7bULL, 0x67e751e8abcc80c2ULL, 0x140e87ef1330cc85ULL, 0xd3f8525e913b9a96ULL,
+  0x1ba1158f3ee3d205ULL, 0x1f6aa87d2c4cdb89ULL, 0x878b32239b5e9a3aULL, 0xa48c7778a498c3edULL,
+  0x1d08f055974ac066ULL, 0xd6de80e9c8a08242ULL, 0x2892ce4ca1cf0b40ULL, 0x604168ae842731c7ULL,
+  0xbecff8b2dd23ee6dULL, 0xa4369751dfac7287ULL, 0x4a5840d9ba8bc89dULL, 0xf53bdbeda7a58582ULL,
+  0xa4149d1ccfba4997ULL, 0xf2c72905d5c66fc3ULL, 0xae4d8e96ce68ad39ULL, 0xc588f396f213a9b5ULL,
+  0x2c618d4e9d6116bbULL, 0xebfb61f3b34420d1ULL, 0xcbdca6f23b702ed7ULL, 0xbe2833957cb78166ULL,
+  0x20c0d09603a2436aULL, 0xbf49b815e190aa6fULL, 0x9b45b90349d78dc3ULL, 0x67eb90e30aa4c4c8ULL,
+  0x7f5ceab1f32b13f0ULL, 0x641eaedbccc48294ULL, 0x80b553586d6aafb6ULL, 0xf1fa779a72b55832ULL,
+  0x8992aefd3b60af74ULL, 0x283594724fa609f2ULL, 0x527dc1a961e7aaf1ULL, 0xbcad693f834e8087ULL,
+  0x95171796c9ca3bf6ULL, 0xb7d367759f41164aULL, 0x5c77677bcf20cf3bULL, 0x47dfd69ff4765b01ULL,
+  0xd708247fd90d6e15ULL, 0xad7996285fe95113ULL, 0xfcfb0ce2c627f9f2ULL, 0x4b0033800f2441ceULL,
+  0x50fa780b72161100ULL, 0xb71ca8b71f72b11aULL, 0x5475baceffab42fdULL, 0x356eef7891c28b39ULL,
+  0xdc80086d1441c9c3ULL, 0xb5c30ec996c47491ULL, 0xa9321adda254e42dULL, 0xc30bee5b963a3612ULL,
+  0xdf141323635c75c7ULL, 0x8926e38f38308f58ULL, 0x897754d871b69592ULL, 0x5bc061743cddde5eULL,
+  0xbebb80a7ad520904ULL, 0xd91d5d335cc284d4ULL, 0x11090e418c6ba748ULL, 0x462cffbc33bb9929ULL,
+  0xefc68605c42a508eULL, 0x230e6cd9602a3a14ULL, 0x49b8eb3126c6f9f4ULL, 0x7c49e7a451bd358fULL,
+  0x1910bb3947b592cbULL, 0xad0ca5183ced6a5bULL, 0xd98ca57993461dcbULL, 0xecc5cb659526948eULL,
+  0x0bddc87dfd1a431bULL, 0x7d9820ac5d694024ULL, 0x716c1ae1ffeb5538ULL, 0x04f8ed8613cffb2fULL,
+  0x1b32eb97d777f039ULL, 0x893da4ee87c1a95fULL, 0x965118d4c235f16cULL, 0xf99023e2e87994baULL,
+  0x891268a5bb8c4545ULL, 0x4d163861e7cf46b4ULL, 0xca688c0e0b2c5681ULL, 0xb86346b536702e5fULL,
+  0x72a6013755e311bbULL, 0x47d10e13142fdc5cULL, 0xac088c30a34ce0cbULL, 0x4d79a2e88f9503feULL,
+  0x02b4c095937670c7ULL, 0x080533c020f8f5e0ULL, 0xab1d0c2581fe8f32ULL, 0xb601bb28048f776dULL,
+  0xf8b8e16e96004a47ULL, 0x4a9fa0426862af7bULL, 0x54384ad4b0b6f662ULL, 0x81670a57a350c0eeULL,
+  0x3a2c282026061dc1ULL, 0xb9749667b575f899ULL, 0xaa853838738dfc2aULL, 0xa53a92a400ccc442ULL,
+  0xbdc8cfa2cfaf5a3eULL, 0x529fee9d09884265ULL, 0x966c709ea4d7f84fULL, 0xd14265d44c80bc42ULL,
+  0xb23c2aedf5ebe7f3ULL, 0xb7d47c42804523f1ULL, 0x73370568a7cb0aa9ULL, 0x66158a1e06d90ac5ULL,
+  0xc4a3898c9805c7adULL, 0x7fc536907890addeULL, 0xc5427e0885c39b20ULL, 0x2fba05edc0c864f8ULL,
+  0x210ad2bfc365017aULL, 0x609ca0038ffb95eaULL, 0x84e663c48e6c4f72ULL, 0x753c1ca83c110562ULL,
+  0x48642afc8700b723ULL, 0xcef1123e14ac952cULL, 0xf075b8b8ed84973cULL, 0xf00a255a0ceac5c9ULL,
+  0x7e77e0dadfcd487cULL, 0x0071cb978be5750cULL, 0x28c4386f560827feULL, 0xbf6b3ad6af4049f0ULL,
+  0x2e3006d1a911aaddULL, 0x2e8489f95eb5bb74ULL, 0x84278164c36fb83dULL, 0x61e0e6be82302b47ULL,
+  0x11b59c560422260eULL, 0x9cd5ecaae4f20c9cULL, 0x9bc72523f866e2daULL, 0x816f533c52c41667ULL,
+  0xa0dbff9e47a3235eULL, 0xea9ca5a30c62a756ULL, 0xc51267e9de0761a6ULL, 0xf28b88663eed2af6ULL,
+  0xfd769663695ed01fULL, 0xbc47fcdf9065af4eULL, 0x424e389cdfca6259ULL, 0xbb03335e166c2c1bULL,
+  0xc4be33dd2a73a1a1ULL, 0x45746bc2e690d058ULL, 0x07d38d7f94b43407ULL, 0x74b851e460854fb3ULL,
+  0xd99df507db3d2ac2ULL, 0x5d6c254c86d3323bULL, 0xb4dd303282bfac22ULL, 0xb7261a5fb27e023bULL,
+  0x40f361bf34fe8179ULL, 0xe716500e6c9e7858ULL, 0x35c6ee0b65873b06ULL, 0xe4c5d4fcfb2864e7ULL,
+  0x858ee284281901c6ULL, 0x44803a65e5fca3cdULL, 0xf9f41e41f850f7f6ULL, 0x87cbf3c965eb5539ULL,
+  0xae056412be2f8074ULL, 0xd8fe916f3c5cb955ULL, 0xd18ccb5eaec289dfULL, 0x446157f20eef81bfULL,
+  0xde9821754690364aULL, 0xd094591bc1597ea0ULL, 0x79676e7ab1ed3e17ULL, 0xa283bdf6c495ebc1ULL,
+  0x6a06b25c648c3570ULL, 0x0deb138c398b0580ULL, 0x4e3d096ae51108edULL, 0xafde012b1dda7416ULL,
+  0xcb001892722f0317ULL, 0x82d756d223875cf7ULL, 0x2091ce44c99114deULL, 0x8a944ef9d24757b4ULL,
+  0xedf8f12b8594145aULL, 0xf30c0ce9998c4affULL, 0xba657a589ce601a0ULL, 0x94e6ec8d36a851ddULL,
+  0x86ada470ed46b938ULL, 0x46c714b9409b507dULL, 0xb628043e05c862a8ULL, 0x8d763a8c7ac4a188ULL,
+  0x7f5ba7970adc18b6ULL, 0x5db4bc6b69073599ULL, 0x3d087e22444d59d3ULL, 0x61466f51e9c04e89ULL,
+  0x151fd405548aa4e6ULL, 0x6090566191555389ULL, 0x3e3c85615e8d5619ULL, 0x2491156c39c6b81cULL,
+  0x17b4d42cfc2fd4a6ULL, 0x2bd704cf82c9bcf9ULL, 0x054032407b2568ecULL, 0x7e037b6b5d2268d9ULL,
+  0x231f10e7d86bec7aULL, 0x964f8501ba016830ULL, 0x9873c321a3b7321fULL, 0xa5a250e1350ac2ddULL,
+  0xc738d24726578385ULL, 0xcd33873c012541caULL, 0xd0cdc82cc5907f19ULL, 0x5656cca45c2b540aULL,
+  0xa3d987b81f887dd1ULL, 0x06a2847883e7fe48ULL, 0x465f2df8945682dbULL, 0xfac8ffbc9b494ce1ULL,
+  0xb12ac825598f39cdULL, 0x3e5c217efa99231bULL, 0xe550fdba3b2d8ba2ULL, 0x846a67338e510006ULL,
+  0xee48a9263e573194ULL, 0x41c394c85ccd36bdULL, 0xa19b67f210a79620ULL, 0x8a285c068b3fd2a6ULL,
+  0x3637050a3a1797d9ULL, 0x7295647e63dfca07ULL, 0xbe8e76017a7b3bbaULL, 0x3c1e511aea660549ULL,
+  0x06c40c25c7a1931aULL, 0x7d1886643796cf70ULL, 0xb9f70031ccd9fa38ULL, 0x87fe9735601e2c75ULL,
+  0xef645dd6f8cd68b0ULL, 0x535d71387d05b323ULL, 0x90327a265c02f47fULL, 0xabd5ea2563ecd3b2ULL,
+  0x302c164101624325ULL, 0x1cdfa6bcdbfbeb93ULL, 0xb15987ed866519a2ULL, 0x0c31ec84113296f1ULL,
+  0xb4132090232a35b2ULL, 0x535172e392d0c3c5ULL, 0xfc24a0a9095ffccbULL, 0x2546326e932c038eULL,
+  0x1bbafc54ccc15e47ULL, 0xa84866303cf2a838ULL, 0x8405b4ae1057e025ULL, 0x1eec4c73da36738dULL,
+  0x4f9ff10488b30f90ULL, 0x6eab7da885eea780ULL, 0x6fe9593d40d9fdbeULL, 0x65606c0c3c850d3cULL,
+  0x70308a34b078a231ULL, 0x6d9a7cbe635af9bdULL, 0x63660519ed73ee32ULL, 0x0e62955f1701dd8dULL,
+  0x9cb66a13180db0e9ULL, 0x78fb88aad3c2cd3eULL, 0xa2859c5285fdbe48ULL, 0x902ffd419579f8f8ULL,
+  0x1f5e048a4b7c6a7bULL, 0x706d24958e262d89ULL, 0x816d7f42ebbbd878ULL, 0x3e6cc58a88cdfbf1ULL,
+  0xaa7dfafd754a64abULL, 0xb63cd2f7e98d0a02ULL, 0x72c5b57f38c8c85cULL, 0xe479da34b97f2b0aULL,
+  0x7c86232a553e33f7ULL, 0xedc6266db35cc8f8ULL, 0x14b7f688ca67e7feULL, 0xb3d3d66f072d997bULL,
+  0x121005b9528c6a42ULL, 0x87d31f390df2b622ULL, 0xedaedb3712ce5fd4ULL, 0x8e53ff2549dec2f4ULL,
+  0x764041aae79e435aULL, 0xb359bd5e29a3ee70ULL, 0x303acd045aa2b047ULL, 0x165795c2b82a2d07ULL,
+  0x950faac1a64ab733ULL, 0xff195e03dfa2861fULL, 0x5eb360ec8cd6e865ULL, 0x19e1a74d639cb063ULL,
+  0x775c20d67ec12528ULL, 0x08722d7fa44c4ddfULL, 0x83d145bcb0c92d32ULL, 0x73da60e43b2207e8ULL,
+  0x962813b9a13d0929ULL, 0xeb6572d6738f420bULL, 0x80a4a0ef151a52caULL, 0x0000000023eee457ULL
+};
+
+static const uint64_t mt19937_64_jump_poly[312] = {
+  0x153fbc23409b1e30ULL, 0xb8d58a2efc1cc7beULL, 0x04cc8df6bd5573e1ULL, 0x8e1b99d6ea322754ULL,
+  0x7fa5c8ab11a78ecfULL, 0xa3f01992f879dc26ULL, 0x77500e62929d74d1ULL, 0x4c65ef439f2dcb2aULL,
+  0x731b3bd3538eec46ULL, 0x14cd564c40c9e3aeULL, 0x6ff65677752268b7ULL, 0xbbea104c48ec8b8dULL,
+  0x08d3565972568ea4ULL, 0x5cb79db1f77395f2ULL, 0x94f5c348a32cecacULL, 0x4b58cc38b6123ed7ULL,
+  0x64d191a00b3e362cULL, 0x7b051615bc105659ULL, 0x2ad11e2d812e15d2ULL, 0xd2551d15c944f218ULL,
+  0x68374254d1f46885ULL, 0x72a5fd7700e8c34fULL, 0xe40b4ac61e14376cULL, 0xbb107cd0a9158cc0ULL,
+  0x5028a2a3d4ce28e6ULL, 0xd0815eeb2e91aa05ULL, 0x29ba386f6309e7ddULL, 0xa19bf128091df643ULL,
+  0xa4dda3ea5af247f8ULL, 0x950ff2c8bc8d9f30ULL, 0xc415a0871ef1af4eULL, 0xe8859d7a5ac3264cULL,
+  0x4d58e6bed0739fe2ULL, 0xb072d474e3f9602cULL, 0x93b112035cf0e33dULL, 0x90d4af56420a0a3dULL,
+  0xcb930cdffd09ba87ULL, 0x82305413c76ba04aULL, 0x88ed61ba7dfc9075ULL, 0xdefc75a7869c145cULL,
+  0x0c16916696775659ULL, 0x94a47bf0b5d3869bULL, 0x026c4476e2551799ULL, 0x2b22d90027fdd747ULL,
+  0xe447af7718644777ULL, 0xbb83f1c03190e0faULL, 0x932fabc717b3114cULL, 0xe0384041dbd5eafdULL,
+  0x698ca9a2304fa895ULL, 0xbbb26eff4e2f6627ULL, 0x453cab967a470645ULL, 0x2a6aefabcd19d4e9ULL,
+  0x808f8d33240f6b90ULL, 0x91bf46c93a4b852bULL, 0x74b6a8597100e697ULL, 0xbd2a4ef239564089ULL,
+  0x9917718e08ec24faULL, 0xac9ce650dccc5d61ULL, 0x52db4d76a2c5546cULL, 0x0123e0fc3cb90aeaULL,
+  0xfe78f1e83bb93635ULL, 0x4f5b739d5ba04851ULL, 0xa4bf7f96e9684a89ULL, 0x5464bb377a97f62eULL,
+  0x328933f006ce14beULL, 0x43e558b7d62ae5d7ULL, 0xddb0f33f21e7d8dcULL, 0x52d2779de93320d2ULL,
+  0x57191c72acfc5093ULL, 0x1779384819ca00e9ULL, 0x7afcfbbe2acaa684ULL, 0x90231d57884a7544ULL,
+  0xdd3ffead4feec6e3ULL, 0x273584a42f1a795dULL, 0x691601338d2c7449ULL, 0x8c8e419ca0529fc3ULL,
+  0x373e37dd051f8b86ULL, 0x27a2d7161f6d06bdULL, 0x954240070472311aULL, 0x471565b60a93d2e4ULL,
+  0x4fb4ad962c328135ULL, 0x7b1a3a92c401e93bULL, 0xf261c3fcc82af141ULL, 0x57241af08978f3ecULL,
+  0x2c79aaa370d1bd4fULL, 0xf35790a0978137d6ULL, 0x38c7263c96234239ULL, 0xe0a13a1dd5f852b5ULL,
+  0x0734f6c962f86802ULL, 0xca52564f72f13f11ULL, 0xa4bd2a9dc69a1248ULL, 0x6f418a04edb45e98ULL,
+  0x764b57a0059aa71aULL, 0x926f6f5f354266dfULL, 0x60c4150013cc9412ULL, 0x3a14980c9d4ccd96ULL,
+  0x4e5da33944239d8bULL, 0x23f3ef6e843c729cULL, 0x389b1022de0ac7c9ULL, 0x369b29d7d285823eULL,
+  0xf556214ad63e2cd9ULL, 0x90e43b9536bc15abULL, 0xa43604007e23fd84ULL, 0x70ee2bd8d9e6c2afULL,
+  0x0e8b6c7a77fd426aULL, 0xed09417ce0d73cdfULL, 0xa3e935e2c81a4021ULL, 0x7cf2e08b288398faULL,
+  0x1e933cde96a31115ULL, 0xdb6014c3a780c561ULL, 0x2bf15950b4660f9dULL, 0x50cf62efc80a3c55ULL,
+  0x448ede02ea0783c5ULL, 0x97df0d14f64c01c7ULL, 0x1353357d543368d0ULL, 0x9bd1449652cdca9cULL,
+  0x66d15aefa7a24321ULL, 0x25dd75fc7492ba9dULL, 0x468ce9a1a3874e13ULL, 0x40ab9e8ed67a4ad1ULL,
+  0x0bafb4d323d02677ULL, 0xf9f3d01c1f435b69ULL, 0x0c4a0fa46fac656aULL, 0xbdac3abdd37e4dfcULL,
+  0xdf9b06ef05db31dfULL, 0xed005f00f37daa7bULL, 0x924be2e465b09410ULL, 0x99099376ea87be57ULL,
+  0x302d8a7c49c4be6aULL, 0xe8effc70541c07a5ULL, 0x6e4611ad196a6ee3ULL, 0xbd42cb15a52cb228ULL,
+  0xce343ee493cdec20ULL, 0x7f4231e3d20e8e72ULL, 0xa2127d2ed81e4f89ULL, 0x27bb32afa1c6ef4cULL,
+  0x9d37d9f4cb87c492ULL, 0xa6b7e94b15e2287cULL, 0x098b4d302e16d6e9ULL, 0x12d1da8ffbf3adb2ULL,
+  0xd5be155bc2fc01deULL, 0x90f630b9e309715bULL, 0xbdb108b0f8da213cULL, 0x98ed520d71f49d1aULL,
+  0x82495aacd19eb9dcULL, 0x124d7478a15025b2ULL, 0xa0eb607ec4087775ULL, 0xcb47955eeabe0890ULL,
+  0x7360a3d0e0b68b89ULL, 0x25f5bee656159d92ULL, 0xeae8434e13f985edULL, 0x04ff38722ad10a86ULL,
+  0xac7097215b434280ULL, 0x3640ae9dd0687b1aULL, 0xb24209a4ce9f603bULL, 0xf03e6fd6f7a416ddULL,
+  0xd31e5bcde48672afULL, 0x2704ce60eb8429a7ULL, 0xf7aeb81f8fcd00c3ULL, 0x5424dbaa0b636a3cULL,
+  0xf352fe250d625a64ULL, 0x9cc12556c2228f86ULL, 0xedac0dbb94e94f51ULL, 0xdd8f2b1f26762fd1ULL,
+  0x5ef488076c7e957fULL, 0x2b734dc8a46c3c61ULL, 0x52111589eb2a22e3ULL, 0xfa11c9bb843df4bcULL,
+  0x5896ac2ecf36f9d2ULL, 0x66c197a7e49dba0aULL, 0xe1eda2cd47aefd0fULL, 0x4cae0acf5d5fa62dULL,
+  0xcb3e21e3f8d7c943ULL, 0x351580d27b75fe44ULL, 0x6cbd4b5618cbab9bULL, 0x8e47ef0542e8a51dULL,
+  0x125adf6b4b59b2efULL, 0x2729dc334cacfd5bULL, 0x883432a737937820ULL, 0x60f002c1dceda4abULL,
+  0xafed1be46e7fd2bcULL, 0xf2a3d1ccbf871115ULL, 0xf85e5c5050ae7160ULL, 0x777cdc44554e6d74ULL,
+  0x0bcf75213e259946ULL, 0x9d0714b4db9ca29aULL, 0x370fdc4067326a6dULL, 0xffeb713807a1cea8ULL,
+  0x7fb0a9674a53e792ULL, 0x62b040005f9ce7bbULL, 0x8903f6b282b67cabULL, 0x3544ff158026eb52ULL,
+  0xd66590248adf92f1ULL, 0x55de1c87a2ebdf48ULL, 0x40b0382287267abaULL, 0x7dfa56a6fb26180eULL,
+  0x45c32d7dc66b19ceULL, 0xf5ed0edf665034c7ULL, 0xf4c7adbe75e15da0ULL, 0x95db8535e0bd9122ULL,
+  0xc571b09620d82713ULL, 0x9c21ed0e78f021f9ULL, 0xd0cb50a9f9aa8defULL, 0xbcb3368c4e9ff5b6ULL,
+  0x06d8f649704939a3ULL, 0x5eaa9ee186d14a54ULL, 0x86d1f972fd4883d0ULL, 0x63b1522f4d50d887ULL,
+  0x982b2fba1a9875a7ULL, 0x7258bfd6235930eaULL, 0xe4ccc8e3c2f0f70eULL, 0x9bf390d119769362ULL,
+  0x1bcea29dbd2c02beULL, 0xd9c189db413398c0ULL, 0x988aa44564f85434ULL, 0x007ed1eaeef5e20aULL,
+  0xa0685fede0eec596ULL, 0xfef177e0b35a7f0eULL, 0x5006596f191ebc61ULL, 0xcba87c3e61bdbc8aULL,
+  0xff2174049069bfcbULL, 0xd7a536ddb2c4f33fULL, 0xf7aecde21fc2d977ULL, 0xc121dca3feef7800ULL,
+  0xa90ad927d025c16bULL, 0x3ea6fee532058e96ULL, 0x9f5210df30acdeb9ULL, 0x520e94889837bcffULL,
+  0x8c6c6a100dabdb5bULL, 0x6d2101f3fc530774ULL, 0x51d535e6dc645e49ULL, 0xe5e7620ed6a4941bULL,
+  0xaf8023c107046243ULL, 0x62e6e40f4ea19600ULL, 0x466396ce1ab8e939ULL, 0x470fc344d01a2a69ULL,
+  0x223011f816549f0eULL, 0x9b0a401733299c57ULL, 0x6e214523ae60b334ULL, 0x84c4cbe45a9b66a6ULL,
+  0x630d39f922b4c0b4ULL, 0xfbfa79ec2c0e1012ULL, 0xe9940485ec80d5c0ULL, 0x1dc1c6fb5a01f32aULL,
+  0x9cd0b7f3a578e57fULL, 0x40b6ce9d50e92c04ULL, 0x588b8af39ab91d81ULL, 0x8058dc2783b02de3ULL,
+  0xbb2103c504392c9dULL, 0x7264692220716211ULL, 0xdb804fcdeb987bbaULL, 0xababd32a49398687ULL,
+  0xe3dee3755b4da875ULL, 0x16de733adb8bb721ULL, 0x99476d13103ffe32ULL, 0x86d2d629666cb05bULL,
+  0x9c4e62ab740ce645ULL, 0xb59682265b7519ffULL, 0x54df6930e9ed43fbULL, 0x33f8218861f98b68ULL,
+  0x21bc749542f06516ULL, 0xd5e9662b4586df7fULL, 0x465569ea0eb5cce4ULL, 0x36a484c938f0ae75ULL,
+  0xc088cc5189f80399ULL, 0x4becd1a8a2280cdeULL, 0x192f20a74dac06f0ULL, 0xae766a8b287a1565ULL,
+  0x036c05ba6abff5f3ULL, 0x5fe448493d8faf69ULL, 0xa880a8ff94b90ea8ULL, 0xd0ec7c6342d2b77bULL,
+  0xd187d7068a2cf90fULL, 0x32523f9ad82e6693ULL, 0x0f87420e87b90726ULL, 0x3a745f953d8e0c35ULL,
+  0x0199993c5a3d1db4ULL, 0x33e45b5766ccb1a0ULL, 0xd2abaac1626e0b0cULL, 0xad5c3023b061fdfbULL,
+  0xf67cf6541cb66e52ULL, 0xe9d9083c635a2190ULL, 0x29a103e0c3b4dac8ULL, 0x75f72adb5e7a7e46ULL,
+  0xdcc943ab2ec296daULL, 0x396a079f137ff14bULL, 0x67853f3d29182ec1ULL, 0x35dd3e7a7a71c780ULL,
+  0xfbf82a6fa275a546ULL, 0x39cc58a7583f7227ULL, 0x8b1b1aedefea9fedULL, 0x909f457dada71450ULL,
+  0xc02abfcbfe3e387aULL, 0xd6871e18b79ae3c1ULL, 0x9f6bac46344f1a0fULL, 0x3366cd78201abcedULL,
+  0xa9da4a5207175299ULL, 0x030642baf1ad5022ULL, 0x5ae120669a844ab0ULL, 0xd8fc12c876b5dbb7ULL,
+  0x2f92b413a6fc6e34ULL, 0x2f2b5a6b0f30aff4ULL, 0x89633b161fac757aULL, 0x5e4bf21ca2b399c2ULL,
+  0x5ed834f955dcf6abULL, 0xd5fdc80d6fa8e6cdULL, 0xcdf09ed99544069fULL, 0xfa9adc855e53297cULL,
+  0x38fa314d5c46ab53ULL, 0x94508c05dda26a06ULL, 0x7de2dae2aa415d2cULL, 0x0000000143ed6f2eULL
+};
+
+/**
+ * Jumps the state of a Mersenne Twister engine ahead by the number of steps represented by the jump polynomial.
+ *
+ * The state X_{i-n}, ..., X_{i-1} is replaced with the sum of poly_j * A^j (X_{i-n}, ..., X_{i-1}),
+ * where A is the state transition and poly_j is the j-th coefficient of the jump polynomial.
+ * The state is accessed via the stream operators, whose textual representation begins with
+ * the n state words in chronological order.
+ */
+template<class UIntType, size_t w, size_t n, size_t m, size_t r, UIntType a, size_t u, UIntType d, size_t s, UIntType b, size_t t, UIntType c, size_t l, UIntType f>
+void mt_jump(std::mersenne_twister_engine<UIntType, w, n, m, r, a, u, d, s, b, t, c, l, f>& rng, const uint64_t* poly, const size_t poly_size) {
+  const UIntType word_mask = w == std::numeric_limits<UIntType>::digits ? ~UIntType(0) : (UIntType(1) << w) - 1;
+  const UIntType upper_mask = (~UIntType(0) << r) & word_mask;
+  const UIntType lower_mask = ~upper_mask & word_mask;
+
+  std::stringstream ss;
+  ss << rng;
+  std::vector<UIntType> state(n);
+  for (size_t i = 0; i < n; i++) ss >> state[i];
+  std::string rest;
+  std::getline(ss, rest);
+
+  // Horner's method on the circular buffer sum[pos], ..., sum[pos + n - 1].
+  std::vector<UIntType> sum(n, 0);
+  size_t pos = 0;
+  bool is_zero = true;
+  for (size_t k = poly_size * 64; k-- > 0;) {
+    if (!is_zero) {
+      const UIntType y = (sum[pos] & upper_mask) | (sum[(pos + 1) % n] & lower_mask);
+      sum[pos] = sum[(pos + m) % n] ^ (y >> 1) ^ ((y & 1) ? a : 0);
+      pos = (pos + 1) % n;
+    }
+    if ((poly[k / 64] >> (k % 64)) & 1) {
+      for (size_t i = 0; i < n; i++) sum[(pos + i) % n] ^= state[i];
+      is_zero = false;
+    }
+  }
+
+  std::stringstream jumped;
+  for (size_t i = 0; i < n; i++) jumped << sum[(pos + i) % n] << ' ';
+  jumped << rest;
+  jumped >> rng;
+}
+
+/**
+ * Advances the state of MT19937 by 2^128 steps.
+ */
+inline void mt_jump(std::mt19937& rng) {
+  mt_jump(rng, mt19937_jump_poly, sizeof(mt19937_jump_poly) / sizeof(uint64_t));
+}
+
+/**
+ * Advances the state of MT19937-64 by 2^128 steps.
+ */
+inline void mt_jump(std::mt19937_64& rng) {
+  mt_jump(rng, mt19937_64_jump_poly, sizeof(mt19937_64_jump_poly) / sizeof(uint64_t));
+}
+
+#endif /* NUMO_RANDOM_MT_JUMP_HPP */
@@ -0,0 +1,239 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_PCG_SIMD_HPP
+#define NUMO_RANDOM_PCG_SIMD_HPP 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <limits>
+#include <type_traits>
+
+// The AVX2 kernel is compiled with the target attribute and selected at runtime,
+// so the extension itself does not need to be built with -mavx2.
+#if !defined(NUMO_RANDOM_DISABLE_SIMD) && (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define NUMO_RANDOM_PCG_SIMD_AVX2 1
+#include <immintrin.h>
+#endif
+
+/**
+ * Multi-lane PCG random number engine that runs eight independent PCG32 (XSH-RR 64/32) generators
+ * in lockstep and interleaves their outputs. Each step advances the eight 64-bit LCG states at once,
+ * in vector registers if the CPU supports AVX2, and emits a block of eight 32-bit random numbers.
+ * The outputs do not depend on whether the AVX2 kernel is used.
+ */
+class pcg32x8 {
+public:
+  typedef uint32_t result_type;
+
+  static const size_t n_lanes = 8;
+
+  pcg32x8() {
+    seed(0xcafef00dd15ea5e5ULL);
+  }
+
+  explicit pcg32x8(const uint64_t val) {
+    seed(val);
+  }
+
+  template<class SeedSeq, typename = typename std::enable_if<!std::is_convertible<SeedSeq, uint64_t>::value
+                                                             && !std::is_same<SeedSeq, pcg32x8>::value>::type>
+  explicit pcg32x8(SeedSeq& seq) {
+    seed(seq);
+  }
+
+  /**
+   * Initializes the states and the increments of the lanes with the outputs of SplitMix64 seeded by the given value.
+   */
+  void seed(uint64_t val) {
+    uint64_t words[2 * n_lanes];
+    for (size_t i = 0; i < 2 * n_lanes; i++) {
+      uint64_t z = (val += 0x9e3779b97f4a7c15ULL);
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      words[i] = z ^ (z >> 31);
+    }
+    init(words);
+  }
+
+  template<class SeedSeq, typename = typename std::enable_if<!std::is_convertible<SeedSeq, uint64_t>::value>::type>
+  void seed(SeedSeq& seq) {
+    uint32_t halves[4 * n_lanes];
+    seq.generate(halves, halves + 4 * n_lanes);
+    uint64_t words[2 * n_lanes];
+    for (size_t i = 0; i < 2 * n_lanes; i++) words[i] = (uint64_t)halves[2 * i] | ((uint64_t)halves[2 * i + 1] << 32);
+    init(words);
+  }
+
+  static constexpr result_type min() {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  result_type operator()() {
+    if (idx_ == n_lanes) {
+      step(state_, inc_, buf_, 1);
+      idx_ = 0;
+    }
+    return buf_[idx_++];
+  }
+
+  /**
+   * Writes the next n random numbers to out. Whole blocks are written by the vectorized kernel directly.
+   */
+  void generate(result_type* out, size_t n) {
+    for (; n > 0 && idx_ < n_lanes; n--) *(out++) = buf_[idx_++];
+    const size_t n_steps = n / n_lanes;
+    step(state_, inc_, out, n_steps);
+    out += n_steps * n_lanes;
+    n -= n_steps * n_lanes;
+    for (; n > 0; n--) *(out++) = operator()();
+  }
+
+  /**
+   * Advances the engine by n random numbers in logarithmic time.
+   */
+  void discard(unsigned long long n) {
+    for (; n > 0 && idx_ < n_lanes; n--) idx_++;
+    const unsigned long long n_steps = n / n_lanes;
+    for (size_t i = 0; i < n_lanes; i++) state_[i] = advance_lcg(state_[i], inc_[i], n_steps);
+    n -= n_steps * n_lanes;
+    if (n > 0) {
+      step(state_, inc_, buf_, 1);
+      idx_ = (size_t)n;
+    }
+  }
+
+  bool operator==(const pcg32x8& other) const {
+    for (size_t i = 0; i < n_lanes; i++) {
+      if (state_[i] != other.state_[i] || inc_[i] != other.inc_[i]) return false;
+    }
+    for (size_t i = idx_; i < n_lanes; i++) {
+      if (buf_[i] != other.buf_[i]) return false;
+    }
+    return idx_ == other.idx_;
+  }
+
+  bool operator!=(const pcg32x8& other) const {
+    return !(*this == other);
+  }
+
+private:
+  static const uint64_t MULT = 6364136223846793005ULL;
+
+  uint64_t state_[n_lanes];
+  uint64_t inc_[n_lanes];
+  result_type buf_[n_lanes];
+  size_t idx_;
+
+  void init(const uint64_t* words) {
+    for (size_t i = 0; i < n_lanes; i++) {
+      inc_[i] = (words[n_lanes + i] << 1) | 1;
+      state_[i] = (words[i] + inc_[i]) * MULT + inc_[i];
+    }
+    idx_ = n_lanes;
+  }
+
+  static uint64_t advance_lcg(const uint64_t state, const uint64_t inc, unsigned long long delta) {
+    uint64_t acc_mult = 1;
+    uint64_t acc_plus = 0;
+    uint64_t cur_mult = MULT;
+    uint64_t cur_plus = inc;
+    while (delta > 0) {
+      if (delta & 1) {
+        acc_mult *= cur_mult;
+        acc_plus = acc_plus * cur_mult + cur_plus;
+      }
+      cur_plus = (cur_mult + 1) * cur_plus;
+      cur_mult *= cur_mult;
+      delta >>= 1;
+    }
+    return acc_mult * state + acc_plus;
+  }
+
+  static void step_scalar(uint64_t* state, const uint64_t* inc, result_type* out, const size_t n_steps) {
+    for (size_t s = 0; s < n_steps; s++) {
+      for (size_t i = 0; i < n_lanes; i++) {
+        const uint64_t old = state[i];
+        state[i] = old * MULT + inc[i];
+        const uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+        const uint32_t rot = (uint32_t)(old >> 59);
+        out[i] = (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+      }
+      out += n_lanes;
+    }
+  }
+
+#ifdef NUMO_RANDOM_PCG_SIMD_AVX2
+  __attribute__((target("avx2"))) static __m256i mul64_avx2(const __m256i a, const __m256i b_lo, const __m256i b_hi) {
+    const __m256i lo = _mm256_mul_epu32(a, b_lo);
+    const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b_lo), _mm256_mul_epu32(a, b_hi));
+    return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+  }
+
+  // Returns the XSH-RR outputs of four 64-bit states in the low 32 bits of each 64-bit lane.
+  __attribute__((target("avx2"))) static __m256i output_avx2(const __m256i old) {
+    const __m256i mask = _mm256_set1_epi64x(0xffffffffLL);
+    const __m256i xorshifted = _mm256_and_si256(_mm256_srli_epi64(_mm256_xor_si256(_mm256_srli_epi64(old, 18), old), 27), mask);
+    const __m256i rot = _mm256_srli_epi64(old, 59);
+    const __m256i lrot = _mm256_sub_epi64(_mm256_set1_epi64x(32), rot);
+    return _mm256_and_si256(_mm256_or_si256(_mm256_srlv_epi64(xorshifted, rot), _mm256_sllv_epi64(xorshifted, lrot)), mask);
+  }
+
+  __attribute__((target("avx2"))) static void step_avx2(uint64_t* state, const uint64_t* inc, result_type* out, const size_t n_steps) {
+    const __m256i mult_lo = _mm256_set1_epi64x((long long)(MULT & 0xffffffffULL));
+    const __m256i mult_hi = _mm256_set1_epi64x((long long)(MULT >> 32));
+    const __m256i pack = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    __m256i s0 = _mm256_loadu_si256((const __m256i*)state);
+    __m256i s1 = _mm256_loadu_si256((const __m256i*)(state + 4));
+    const __m256i c0 = _mm256_loadu_si256((const __m256i*)inc);
+    const __m256i c1 = _mm256_loadu_si256((const __m256i*)(inc + 4));
+    for (size_t s = 0; s < n_steps; s++) {
+      const __m256i r0 = _mm256_permutevar8x32_epi32(output_avx2(s0), pack);
+      const __m256i r1 = _mm256_permutevar8x32_epi32(output_avx2(s1), pack);
+      _mm256_storeu_si256((__m256i*)out, _mm256_permute2x128_si256(r0, r1, 0x20));
+      s0 = _mm256_add_epi64(mul64_avx2(s0, mult_lo, mult_hi), c0);
+      s1 = _mm256_add_epi64(mul64_avx2(s1, mult_lo, mult_hi), c1);
+      out += n_lanes;
+    }
+    _mm256_storeu_si256((__m256i*)state, s0);
+    _mm256_storeu_si256((__m256i*)(state + 4), s1);
+  }
+
+  static bool has_avx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+  }
+#endif
+
+  static void step(uint64_t* state, const uint64_t* inc, result_type* out, const size_t n_steps) {
+#ifdef NUMO_RANDOM_PCG_SIMD_AVX2
+    if (has_avx2()) {
+      step_avx2(state, inc, out, n_steps);
+      return;
+    }
+#endif
+    step_scalar(state, inc, out, n_steps);
+  }
+};
+
+#endif /* NUMO_RANDOM_PCG_SIMD_HPP */
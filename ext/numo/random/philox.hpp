@@ -0,0 +1,216 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_PHILOX_HPP
+#define NUMO_RANDOM_PHILOX_HPP 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <limits>
+#include <type_traits>
+
+#include "random_bits.hpp"
+
+template<typename UIntType> struct philox_constants;
+
+template<> struct philox_constants<uint32_t> {
+  static const uint32_t M0 = 0xD2511F53U;
+  static const uint32_t M1 = 0xCD9E8D57U;
+  static const uint32_t W0 = 0x9E3779B9U;
+  static const uint32_t W1 = 0xBB67AE85U;
+
+  static uint32_t mulhilo(const uint32_t a, const uint32_t b, uint32_t& hi) {
+    const uint64_t prod = (uint64_t)a * b;
+    hi = (uint32_t)(prod >> 32);
+    return (uint32_t)prod;
+  }
+};
+
+template<> struct philox_constants<uint64_t> {
+  static const uint64_t M0 = 0xD2E7470EE14C6C93ULL;
+  static const uint64_t M1 = 0xCA5A826395121157ULL;
+  static const uint64_t W0 = 0x9E3779B97F4A7C15ULL;
+  static const uint64_t W1 = 0xBB67AE8584CAA73BULL;
+
+  static uint64_t mulhilo(const uint64_t a, const uint64_t b, uint64_t& hi) {
+    return mulhilo64(a, b, hi);
+  }
+};
+
+/**
+ * Philox4xW-10 counter-based random number engine by Salmon et al.
+ * The n-th random number is the (n % 4)-th word of the block obtained by encrypting the counter n / 4 with the key,
+ * so the engine can move to any position in constant time. It satisfies the requirements of
+ * the C++ uniform random bit generator, so it can be used with the standard distributions.
+ */
+template<typename UIntType> class philox4x_engine {
+public:
+  typedef UIntType result_type;
+
+  static const size_t n_words = 4;
+  static const size_t n_key_words = 2;
+  static const size_t n_rounds = 10;
+
+  philox4x_engine() {
+    seed(0);
+  }
+
+  explicit philox4x_engine(const uint64_t val) {
+    seed(val);
+  }
+
+  template<class SeedSeq, typename = typename std::enable_if<!std::is_convertible<SeedSeq, uint64_t>::value
+                                                             && !std::is_same<SeedSeq, philox4x_engine>::value>::type>
+  explicit philox4x_engine(SeedSeq& seq) {
+    seed(seq);
+  }
+
+  /**
+   * Uses the seed as the key and resets the counter to zero.
+   */
+  void seed(const uint64_t val) {
+    key_[0] = (result_type)val;
+    key_[1] = std::numeric_limits<result_type>::digits < 64 ? (result_type)(val >> 32) : 0;
+    reset_counter();
+  }
+
+  /**
+   * Generates the key from the seed sequence and resets the counter to zero.
+   */
+  template<class SeedSeq, typename = typename std::enable_if<!std::is_convertible<SeedSeq, uint64_t>::value>::type>
+  void seed(SeedSeq& seq) {
+    const size_t n_seed_words = n_key_words * sizeof(result_type) / sizeof(uint32_t);
+    uint32_t words[n_key_words * sizeof(result_type) / sizeof(uint32_t)];
+    seq.generate(words, words + n_seed_words);
+    for (size_t i = 0; i < n_key_words; i++) {
+      key_[i] = 0;
+      for (size_t j = sizeof(result_type) / sizeof(uint32_t); j-- > 0;) {
+        key_[i] = (result_type)(((uint64_t)key_[i] << 16) << 16) | words[i * sizeof(result_type) / sizeof(uint32_t) + j];
+      }
+    }
+    reset_counter();
+  }
+
+  static constexpr result_type min() {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  result_type operator()() {
+    if (idx_ == n_words) {
+      add_counter(1);
+      idx_ = 0;
+      generate_block();
+    }
+    return block_[idx_++];
+  }
+
+  void discard(unsigned long long n) {
+    const unsigned long long n_blocks = n / n_words;
+    result_type delta[n_words] = { 0, 0, 0, 0 };
+    delta[0] = (result_type)n_blocks;
+    if (std::numeric_limits<result_type>::digits < 64) delta[1] = (result_type)((n_blocks >> 16) >> 16);
+    advance(delta, (size_t)(n % n_words));
+  }
+
+  /**
+   * Moves the engine forward by (delta_blocks * 4 + delta_idx) random numbers, where delta_blocks is
+   * the little-endian multiword integer of four words. The position wraps around at the end of the counter space.
+   */
+  void advance(const result_type* delta_blocks, const size_t delta_idx) {
+    const size_t idx = idx_ + delta_idx;
+    add_counter(delta_blocks, (result_type)(idx / n_words));
+    idx_ = idx % n_words;
+    generate_block();
+  }
+
+  const result_type* counter() const {
+    return counter_;
+  }
+
+  const result_type* key() const {
+    return key_;
+  }
+
+  bool operator==(const philox4x_engine& other) const {
+    for (size_t i = 0; i < n_words; i++) {
+      if (counter_[i] != other.counter_[i]) return false;
+    }
+    return key_[0] == other.key_[0] && key_[1] == other.key_[1] && idx_ == other.idx_;
+  }
+
+  bool operator!=(const philox4x_engine& other) const {
+    return !(*this == other);
+  }
+
+private:
+  typedef philox_constants<result_type> consts;
+
+  result_type counter_[n_words];
+  result_type key_[n_key_words];
+  result_type block_[n_words];
+  size_t idx_;
+
+  void reset_counter() {
+    for (size_t i = 0; i < n_words; i++) counter_[i] = 0;
+    idx_ = 0;
+    generate_block();
+  }
+
+  void add_counter(const result_type carry_in) {
+    const result_type zero[n_words] = { 0, 0, 0, 0 };
+    add_counter(zero, carry_in);
+  }
+
+  void add_counter(const result_type* delta, result_type carry) {
+    for (size_t i = 0; i < n_words; i++) {
+      const result_type sum = counter_[i] + delta[i];
+      const result_type c = sum < counter_[i] ? 1 : 0;
+      counter_[i] = sum + carry;
+      carry = c | (counter_[i] < sum ? 1 : 0);
+    }
+  }
+
+  void generate_block() {
+    result_type ctr[n_words] = { counter_[0], counter_[1], counter_[2], counter_[3] };
+    result_type round_key[n_key_words] = { key_[0], key_[1] };
+    for (size_t r = 0; r < n_rounds; r++) {
+      if (r > 0) {
+        round_key[0] += consts::W0;
+        round_key[1] += consts::W1;
+      }
+      result_type hi0, hi1;
+      const result_type lo0 = consts::mulhilo(consts::M0, ctr[0], hi0);
+      const result_type lo1 = consts::mulhilo(consts::M1, ctr[2], hi1);
+      ctr[0] = hi1 ^ ctr[1] ^ round_key[0];
+      ctr[1] = lo1;
+      ctr[2] = hi0 ^ ctr[3] ^ round_key[1];
+      ctr[3] = lo0;
+    }
+    for (size_t i = 0; i < n_words; i++) block_[i] = ctr[i];
+  }
+};
+
+typedef philox4x_engine<uint32_t> philox4x32;
+typedef philox4x_engine<uint64_t> philox4x64;
+
+#endif /* NUMO_RANDOM_PHILOX_HPP */
@@ -0,0 +1,157 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_POISSON_HPP
+#define NUMO_RANDOM_POISSON_HPP 1
+
+#include <stdint.h>
+
+#include <cmath>
+
+#include "gamma.hpp"
+#include "random_bits.hpp"
+
+/**
+ * Poisson distribution sampled with the transformed rejection method with squeeze (PTRS) by Hoermann
+ * if the mean is at least 10, and with the multiplication method otherwise, in the same way as NumPy.
+ * The constants of either method are computed once in the constructor. It has the same interface as
+ * std::poisson_distribution.
+ */
+template<typename IntType = int> class ptrs_poisson_distribution {
+public:
+  typedef IntType result_type;
+
+  explicit ptrs_poisson_distribution(const double mean = 1.0) : mean_(mean) {
+    use_ptrs_ = mean >= 10;
+    if (use_ptrs_) {
+      slam_ = std::sqrt(mean);
+      loglam_ = std::log(mean);
+      b_ = 0.931 + 2.53 * slam_;
+      a_ = -0.059 + 0.02483 * b_;
+      log_invalpha_ = std::log(1.1239 + 1.1328 / (b_ - 3.4));
+      vr_ = 0.9277 - 3.6224 / (b_ - 2);
+    } else {
+      enlam_ = std::exp(-mean);
+    }
+  }
+
+  double mean() const {
+    return mean_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    if (mean_ == 0) return 0;
+    return static_cast<IntType>(use_ptrs_ ? ptrs(rng) : multiplication(rng));
+  }
+
+private:
+  double mean_;
+  bool use_ptrs_;
+  // constants of PTRS.
+  double slam_, loglam_, a_, b_, log_invalpha_, vr_;
+  // constant of the multiplication method.
+  double enlam_;
+
+  // Returns log(Gamma(x)) for a positive integer x with Stirling's series, which gives the same value
+  // on every platform unlike std::lgamma.
+  static double loggam(const double x) {
+    static const double coef[10] = { 8.333333333333333e-02, -2.777777777777778e-03, 7.936507936507937e-04,
+                                     -5.952380952380952e-04, 8.417508417508418e-04, -1.917526917526918e-03,
+                                     6.410256410256410e-03, -2.955065359477124e-02, 1.796443723688307e-01,
+                                     -1.39243221690590e+00 };
+    if (x == 1.0 || x == 2.0) return 0.0;
+    // shift small arguments up to 7, where the series is accurate.
+    const int64_t n = x < 7.0 ? static_cast<int64_t>(7 - x) : 0;
+    double x0 = x + static_cast<double>(n);
+    const double x2 = (1.0 / x0) * (1.0 / x0);
+    double gl0 = coef[9];
+    for (int k = 8; k >= 0; k--) {
+      gl0 *= x2;
+      gl0 += coef[k];
+    }
+    double gl = gl0 / x0 + 0.9189385332046727 + (x0 - 0.5) * std::log(x0) - x0;
+    for (int64_t k = 1; k <= n; k++) {
+      gl -= std::log(x0 - 1.0);
+      x0 -= 1.0;
+    }
+    return gl;
+  }
+
+  template<class Rng> int64_t ptrs(Rng& rng) const {
+    for (;;) {
+      const double u = next_double(rng) - 0.5;
+      const double v = next_double(rng);
+      const double us = 0.5 - std::fabs(u);
+      const int64_t k = static_cast<int64_t>(std::floor((2 * a_ / us + b_) * u + mean_ + 0.43));
+      if (us >= 0.07 && v <= vr_) return k;
+      if (k < 0 || (us < 0.013 && v > us)) continue;
+      if (std::log(v) + log_invalpha_ - std::log(a_ / (us * us) + b_) <= -mean_ + static_cast<double>(k) * loglam_ - loggam(static_cast<double>(k + 1))) {
+        return k;
+      }
+    }
+  }
+
+  template<class Rng> int64_t multiplication(Rng& rng) const {
+    int64_t x = 0;
+    double prod = 1.0;
+    for (;;) {
+      prod *= next_double(rng);
+      if (prod <= enlam_) return x;
+      x++;
+    }
+  }
+};
+
+/**
+ * Negative binomial distribution of the number of failures before the k-th success, sampled as the Poisson
+ * distribution whose mean follows the gamma distribution with shape k and scale (1 - p) / p, in the same way
+ * as NumPy. It has the same interface as std::negative_binomial_distribution.
+ */
+template<typename IntType = int> class gamma_poisson_negative_binomial_distribution {
+public:
+  typedef IntType result_type;
+
+  explicit gamma_poisson_negative_binomial_distribution(const IntType k = 1, const double p = 0.5)
+    : k_(k), p_(p), gamma_(k > 0 ? static_cast<double>(k) : 1.0), scale_((1.0 - p) / p) {}
+
+  IntType k() const {
+    return k_;
+  }
+
+  double p() const {
+    return p_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    if (k_ == 0 || p_ == 1.0) return 0;
+    ptrs_poisson_distribution<int64_t> poisson(gamma_(rng) * scale_);
+    return static_cast<IntType>(poisson(rng));
+  }
+
+private:
+  IntType k_;
+  double p_;
+  marsaglia_tsang_gamma gamma_;
+  double scale_;
+};
+
+#endif /* NUMO_RANDOM_POISSON_HPP */
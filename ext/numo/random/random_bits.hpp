@@ -0,0 +1,94 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_RANDOM_BITS_HPP
+#define NUMO_RANDOM_RANDOM_BITS_HPP 1
+
+#include <stdint.h>
+
+/**
+ * Draws raw random bits from the engines, which generate either 32-bit or 64-bit unsigned integers
+ * over the full range of the type. The in-house samplers are built on these functions rather than
+ * on the standard distributions, so their results do not depend on the C++ standard library.
+ */
+template<class Rng, bool = (Rng::max() > 0xffffffffULL)> struct random_bits {
+  static uint64_t next_uint64(Rng& rng) {
+    return static_cast<uint64_t>(rng());
+  }
+};
+
+template<class Rng> struct random_bits<Rng, false> {
+  static uint64_t next_uint64(Rng& rng) {
+    // the first output goes to the upper half.
+    const uint64_t hi = static_cast<uint64_t>(rng());
+    const uint64_t lo = static_cast<uint64_t>(rng());
+    return (hi << 32) | lo;
+  }
+};
+
+template<class Rng> inline uint64_t next_uint64(Rng& rng) {
+  return random_bits<Rng>::next_uint64(rng);
+}
+
+/**
+ * Multiplies two 64-bit integers into a 128-bit product, and returns the lower half and stores the upper half in hi.
+ * The 128-bit integer type is not available on MSVC and 32-bit targets, where the product is assembled from
+ * four 32x32-bit partial products.
+ */
+inline uint64_t mulhilo64(const uint64_t a, const uint64_t b, uint64_t& hi) {
+#ifdef __SIZEOF_INT128__
+  const unsigned __int128 prod = static_cast<unsigned __int128>(a) * b;
+  hi = static_cast<uint64_t>(prod >> 64);
+  return static_cast<uint64_t>(prod);
+#else
+  const uint64_t a_lo = a & 0xffffffffULL;
+  const uint64_t a_hi = a >> 32;
+  const uint64_t b_lo = b & 0xffffffffULL;
+  const uint64_t b_hi = b >> 32;
+  const uint64_t ll = a_lo * b_lo;
+  const uint64_t lh = a_lo * b_hi;
+  const uint64_t hl = a_hi * b_lo;
+  const uint64_t hh = a_hi * b_hi;
+  const uint64_t mid = (ll >> 32) + (lh & 0xffffffffULL) + (hl & 0xffffffffULL);
+  hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+  return (mid << 32) | (ll & 0xffffffffULL);
+#endif
+}
+
+/**
+ * Returns a number in [0, 1) made from the upper 53 bits of a 64-bit integer.
+ */
+inline double bits_to_double(const uint64_t bits) {
+  return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * Returns a number in [0, 1) made from the upper 24 bits of a 32-bit integer.
+ */
+inline float bits_to_float(const uint32_t bits) {
+  return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * Returns a random number in [0, 1) made from the upper 53 bits of a 64-bit random integer.
+ */
+template<class Rng> inline double next_double(Rng& rng) {
+  return bits_to_double(next_uint64(rng));
+}
+
+#endif /* NUMO_RANDOM_RANDOM_BITS_HPP */
@@ -0,0 +1,118 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_SEED_SEQ_HPP
+#define NUMO_RANDOM_SEED_SEQ_HPP 1
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * Seed sequence that mixes entropy of arbitrary length into a fixed-size pool with the hash-based
+ * algorithm of NumPy's SeedSequence, and expands the pool into any number of well-distributed 32-bit words.
+ * It satisfies the requirements of the C++ SeedSequence, so it can be given to the constructor of
+ * the standard and PCG random engines.
+ */
+class hashmix_seed_seq {
+public:
+  typedef uint32_t result_type;
+
+  static const size_t default_pool_size = 4;
+
+  hashmix_seed_seq() : pool_(default_pool_size, 0) {}
+
+  /**
+   * Creates the pool from the entropy words and the spawn key words.
+   * The entropy is padded with zeros to the pool size if the spawn key is not empty, as in NumPy.
+   */
+  hashmix_seed_seq(const std::vector<uint32_t>& entropy, const std::vector<uint32_t>& spawn_key, const size_t pool_size = default_pool_size)
+    : pool_(pool_size, 0) {
+    std::vector<uint32_t> words(entropy);
+    if (!spawn_key.empty() && words.size() < pool_size) words.resize(pool_size, 0);
+    words.insert(words.end(), spawn_key.begin(), spawn_key.end());
+    mix_entropy(words);
+  }
+
+  template<class RandomIt> void generate(RandomIt begin, RandomIt end) const {
+    uint32_t hash_const = INIT_B;
+    const size_t pool_size = pool_.size();
+    for (size_t i = 0; begin != end; ++begin, ++i) {
+      uint32_t val = pool_[i % pool_size];
+      val ^= hash_const;
+      hash_const *= MULT_B;
+      val *= hash_const;
+      val ^= val >> XSHIFT;
+      *begin = val;
+    }
+  }
+
+  size_t size() const {
+    return pool_.size();
+  }
+
+  template<class OutputIt> void param(OutputIt dest) const {
+    std::copy(pool_.begin(), pool_.end(), dest);
+  }
+
+private:
+  static const uint32_t INIT_A = 0x43b0d7e5;
+  static const uint32_t MULT_A = 0x931e8875;
+  static const uint32_t INIT_B = 0x8b51f9dd;
+  static const uint32_t MULT_B = 0x58f38ded;
+  static const uint32_t MIX_MULT_L = 0xca01f9dd;
+  static const uint32_t MIX_MULT_R = 0x4973f715;
+  static const int XSHIFT = 16;
+
+  std::vector<uint32_t> pool_;
+
+  static uint32_t hashmix(uint32_t val, uint32_t& hash_const) {
+    val ^= hash_const;
+    hash_const *= MULT_A;
+    val *= hash_const;
+    val ^= val >> XSHIFT;
+    return val;
+  }
+
+  static uint32_t mix(const uint32_t x, const uint32_t y) {
+    uint32_t res = MIX_MULT_L * x - MIX_MULT_R * y;
+    res ^= res >> XSHIFT;
+    return res;
+  }
+
+  void mix_entropy(const std::vector<uint32_t>& entropy) {
+    uint32_t hash_const = INIT_A;
+    const size_t pool_size = pool_.size();
+    for (size_t i = 0; i < pool_size; i++) {
+      pool_[i] = hashmix(i < entropy.size() ? entropy[i] : 0, hash_const);
+    }
+    for (size_t i_src = 0; i_src < pool_size; i_src++) {
+      for (size_t i_dst = 0; i_dst < pool_size; i_dst++) {
+        if (i_src != i_dst) pool_[i_dst] = mix(pool_[i_dst], hashmix(pool_[i_src], hash_const));
+      }
+    }
+    for (size_t i_src = pool_size; i_src < entropy.size(); i_src++) {
+      for (size_t i_dst = 0; i_dst < pool_size; i_dst++) {
+        pool_[i_dst] = mix(pool_[i_dst], hashmix(entropy[i_src], hash_const));
+      }
+    }
+  }
+};
+
+#endif /* NUMO_RANDOM_SEED_SEQ_HPP */
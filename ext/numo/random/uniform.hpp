@@ -0,0 +1,184 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_UNIFORM_HPP
+#define NUMO_RANDOM_UNIFORM_HPP 1
+
+#include <stdint.h>
+
+#include "random_bits.hpp"
+
+/**
+ * Continuous uniform distribution on [a, b) that converts random bits to floating-point numbers directly,
+ * instead of through std::generate_canonical. A double is made from the upper 53 bits of a 64-bit random
+ * integer, and a float from the upper 24 bits of a 32-bit one, so that an engine generating 64-bit integers
+ * gives two floats per call. It has the same interface as std::uniform_real_distribution.
+ */
+template<typename RealType = double> class bits_uniform_real_distribution {
+public:
+  typedef RealType result_type;
+
+  explicit bits_uniform_real_distribution(const RealType a = 0, const RealType b = 1) : a_(a), b_(b), cached_(false), word_(0) {}
+
+  RealType a() const {
+    return a_;
+  }
+
+  RealType b() const {
+    return b_;
+  }
+
+  void reset() {
+    cached_ = false;
+  }
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    return canonical(rng, static_cast<RealType*>(0)) * (b_ - a_) + a_;
+  }
+
+private:
+  RealType a_;
+  RealType b_;
+  // the lower half of the last 64-bit random integer, which gives the next float.
+  bool cached_;
+  uint32_t word_;
+
+  template<class Rng> double canonical(Rng& rng, double*) {
+    return bits_to_double(next_uint64(rng));
+  }
+
+  template<class Rng> float canonical(Rng& rng, float*) {
+    if (Rng::max() <= 0xffffffffULL) return bits_to_float(static_cast<uint32_t>(rng()));
+    if (cached_) {
+      cached_ = false;
+      return bits_to_float(word_);
+    }
+    const uint64_t bits = next_uint64(rng);
+    word_ = static_cast<uint32_t>(bits);
+    cached_ = true;
+    return bits_to_float(static_cast<uint32_t>(bits >> 32));
+  }
+};
+
+/**
+ * Discrete uniform distribution on [a, a + span] sampled with the multiply-shift method by Lemire.
+ * A w-bit random integer r is mapped to (r * n) >> w for n = span + 1, and is rejected only if the lower w bits
+ * of the product are less than 2^w mod n. The threshold is computed once in the constructor, so no division is
+ * needed for each value. Ranges up to 2^32 use 32-bit random integers, and an engine generating 64-bit integers
+ * gives two of them per call.
+ */
+template<typename IntType = int> class lemire_uniform_int_distribution {
+public:
+  typedef IntType result_type;
+
+  explicit lemire_uniform_int_distribution(const IntType a = 0, const uint64_t span = 0) : a_(a), span_(span), cached_(false), word_(0) {
+    if (span_ < 0xffffffffULL) {
+      const uint32_t n = static_cast<uint32_t>(span_) + 1;
+      threshold_ = static_cast<uint32_t>(-n) % n;
+    } else if (span_ > 0xffffffffULL && span_ < UINT64_MAX) {
+      const uint64_t n = span_ + 1;
+      threshold_ = (0 - n) % n;
+    } else {
+      threshold_ = 0;
+    }
+  }
+
+  IntType a() const {
+    return a_;
+  }
+
+  uint64_t span() const {
+    return span_;
+  }
+
+  void reset() {
+    cached_ = false;
+  }
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    const uint64_t offset = span_ <= 0xffffffffULL ? bounded32(rng) : bounded64(rng);
+    return static_cast<IntType>(static_cast<uint64_t>(a_) + offset);
+  }
+
+private:
+  IntType a_;
+  uint64_t span_;
+  uint64_t threshold_;
+  // the lower half of the last 64-bit random integer, which gives the next 32-bit one.
+  bool cached_;
+  uint32_t word_;
+
+  template<class Rng> uint32_t next_uint32(Rng& rng) {
+    if (Rng::max() <= 0xffffffffULL) return static_cast<uint32_t>(rng());
+    if (cached_) {
+      cached_ = false;
+      return word_;
+    }
+    const uint64_t bits = next_uint64(rng);
+    word_ = static_cast<uint32_t>(bits);
+    cached_ = true;
+    return static_cast<uint32_t>(bits >> 32);
+  }
+
+  template<class Rng> uint64_t bounded32(Rng& rng) {
+    const uint32_t r = next_uint32(rng);
+    if (span_ == 0xffffffffULL) return r;
+    const uint64_t n = span_ + 1;
+    uint64_t m = static_cast<uint64_t>(r) * n;
+    while (static_cast<uint32_t>(m) < threshold_) m = static_cast<uint64_t>(next_uint32(rng)) * n;
+    return m >> 32;
+  }
+
+  template<class Rng> uint64_t bounded64(Rng& rng) {
+    const uint64_t r = next_uint64(rng);
+    if (span_ == UINT64_MAX) return r;
+    const uint64_t n = span_ + 1;
+    uint64_t hi;
+    uint64_t lo = mulhilo64(r, n, hi);
+    while (lo < threshold_) lo = mulhilo64(next_uint64(rng), n, hi);
+    return hi;
+  }
+};
+
+/**
+ * Returns a random integer in [0, span] with the multiply-shift method by Lemire, for a bound that changes
+ * from call to call as in shuffling. The threshold of the rejection, which needs a division, is computed only
+ * if the product falls in the range where a rejection can occur.
+ */
+template<class Rng> inline uint64_t next_bounded_uint64(Rng& rng, const uint64_t span) {
+  if (Rng::max() <= 0xffffffffULL && span < 0xffffffffULL) {
+    const uint32_t n = static_cast<uint32_t>(span) + 1;
+    uint64_t m = static_cast<uint64_t>(static_cast<uint32_t>(rng())) * n;
+    if (static_cast<uint32_t>(m) < n) {
+      const uint32_t t = static_cast<uint32_t>(-n) % n;
+      while (static_cast<uint32_t>(m) < t) m = static_cast<uint64_t>(static_cast<uint32_t>(rng())) * n;
+    }
+    return m >> 32;
+  }
+  if (span == UINT64_MAX) return next_uint64(rng);
+  const uint64_t n = span + 1;
+  uint64_t hi;
+  uint64_t lo = mulhilo64(next_uint64(rng), n, hi);
+  if (lo < n) {
+    const uint64_t t = (0 - n) % n;
+    while (lo < t) lo = mulhilo64(next_uint64(rng), n, hi);
+  }
+  return hi;
+}
+
+#endif /* NUMO_RANDOM_UNIFORM_HPP */
@@ -0,0 +1,142 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_XOSHIRO_HPP
+#define NUMO_RANDOM_XOSHIRO_HPP 1
+
+#include <stdint.h>
+
+#include <limits>
+#include <type_traits>
+
+/**
+ * xoshiro256++ random number engine by David Blackman and Sebastiano Vigna.
+ * It has 256-bit state and a period of 2^256 - 1, and satisfies the requirements of
+ * the C++ uniform random bit generator, so it can be used with the standard distributions.
+ */
+class xoshiro256pp {
+public:
+  typedef uint64_t result_type;
+
+  static const uint64_t default_seed = 0xcafef00dd15ea5e5ULL;
+
+  xoshiro256pp() {
+    seed(default_seed);
+  }
+
+  explicit xoshiro256pp(const uint64_t val) {
+    seed(val);
+  }
+
+  template<class SeedSeq, typename = typename std::enable_if<!std::is_convertible<SeedSeq, uint64_t>::value
+                                                             && !std::is_same<SeedSeq, xoshiro256pp>::value>::type>
+  explicit xoshiro256pp(SeedSeq& seq) {
+    seed(seq);
+  }
+
+  /**
+   * Initializes the state with the outputs of SplitMix64 seeded by the given value, as recommended by the authors.
+   */
+  void seed(uint64_t val) {
+    for (int i = 0; i < 4; i++) {
+      uint64_t z = (val += 0x9e3779b97f4a7c15ULL);
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      s_[i] = z ^ (z >> 31);
+    }
+  }
+
+  template<class SeedSeq, typename = typename std::enable_if<!std::is_convertible<SeedSeq, uint64_t>::value>::type>
+  void seed(SeedSeq& seq) {
+    uint32_t words[8];
+    seq.generate(words, words + 8);
+    for (int i = 0; i < 4; i++) s_[i] = (uint64_t)words[2 * i] | ((uint64_t)words[2 * i + 1] << 32);
+    // the all-zero state is the only invalid state.
+    if ((s_[0] | s_[1] | s_[2] | s_[3]) == 0) s_[0] = 1;
+  }
+
+  static constexpr result_type min() {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  result_type operator()() {
+    const uint64_t res = rotl(s_[0] + s_[3], 23) + s_[0];
+    const uint64_t t = s_[1] << 17;
+    s_[2] ^= s_[0];
+    s_[3] ^= s_[1];
+    s_[1] ^= s_[2];
+    s_[0] ^= s_[3];
+    s_[2] ^= t;
+    s_[3] = rotl(s_[3], 45);
+    return res;
+  }
+
+  void discard(unsigned long long n) {
+    for (; n > 0; n--) operator()();
+  }
+
+  /**
+   * Advances the state by 2^128 steps.
+   */
+  void jump() {
+    static const uint64_t poly[4] = { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+    jump(poly);
+  }
+
+  /**
+   * Advances the state by 2^192 steps.
+   */
+  void long_jump() {
+    static const uint64_t poly[4] = { 0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL, 0x77710069854ee241ULL, 0x39109bb02acbe635ULL };
+    jump(poly);
+  }
+
+  bool operator==(const xoshiro256pp& other) const {
+    return s_[0] == other.s_[0] && s_[1] == other.s_[1] && s_[2] == other.s_[2] && s_[3] == other.s_[3];
+  }
+
+  bool operator!=(const xoshiro256pp& other) const {
+    return !(*this == other);
+  }
+
+private:
+  uint64_t s_[4];
+
+  static uint64_t rotl(const uint64_t x, const int k) {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  void jump(const uint64_t* poly) {
+    uint64_t t[4] = { 0, 0, 0, 0 };
+    for (int i = 0; i < 4; i++) {
+      for (int b = 0; b < 64; b++) {
+        if (poly[i] & (uint64_t(1) << b)) {
+          for (int j = 0; j < 4; j++) t[j] ^= s_[j];
+        }
+        operator()();
+      }
+    }
+    for (int j = 0; j < 4; j++) s_[j] = t[j];
+  }
+};
+
+#endif /* NUMO_RANDOM_XOSHIRO_HPP */
@@ -0,0 +1,681 @@
+/**
+ * Numo::Random provides random number generation with several distributions for Numo::NArray.
+ *
+ * Copyright (c) 2022-2026 Atsushi Tatsuma
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NUMO_RANDOM_ZIGGURAT_HPP
+#define NUMO_RANDOM_ZIGGURAT_HPP 1
+
+#include <stdint.h>
+
+#include <cmath>
+
+#include "random_bits.hpp"
+
+/**
+ * Tables of the 256-layer Ziggurat method by Marsaglia and Tsang. The layers are laid out as in NumPy:
+ * k[i] is the acceptance threshold for the mantissa of layer i (52 bits for the normal density and
+ * 53 bits for the exponential density), w[i] scales the mantissa to the abscissa, and f[i] is the value
+ * of the density at the right edge of layer i. The tables are written as literals instead of being computed
+ * at startup, so that the samples are identical on every platform.
+ */
+template<typename T = void> struct ziggurat_tables {
+  // right edge of the base layer of the normal density.
+  static const double r_normal;
+  static const uint64_t ki_normal[256];
+  static const double wi_normal[256];
+  static const double fi_normal[256];
+  // right edge of the base layer of the exponential density.
+  static const double r_exp;
+  static const uint64_t ke_exp[256];
+  static const double we_exp[256];
+  static const double fe_exp[256];
+};
+
+template<typename T> const double ziggurat_tables<T>::r_normal = 3.6541528853610088;
+
+template<typename T> const double ziggurat_tables<T>::r_exp = 7.697117470131487;
+
+template<typename T> const uint64_t ziggurat_tables<T>::ki_normal[256] = {
+  0x000ef33d8025bc39ULL, 0x0000000000000000ULL, 0x000c08be98f2acaaULL, 0x000da354faba4236ULL,
+  0x000e51f67ec049b5ULL, 0x000eb255e9d2fa41ULL, 0x000eef4b817e221cULL, 0x000f19470af9cc80ULL,
+  0x000f37ed61ff712fULL, 0x000f4f469560df95ULL, 0x000f61a5e41b6be3ULL, 0x000f707a75536926ULL,
+  0x000f7cb2ec281ec3ULL, 0x000f86f10c6337d8ULL, 0x000f8fa657830a7dULL, 0x000f9724c74db926ULL,
+  0x000f9da907dbe051ULL, 0x000fa360f581e82eULL, 0x000fa86fde5b3bbfULL, 0x000facf160d34659ULL,
+  0x000fb0fb6718ac00ULL, 0x000fb49f8d5368f8ULL, 0x000fb7ec2366f3bdULL, 0x000fbaece9a1db42ULL,
+  0x000fbdab9d0402f5ULL, 0x000fc03060ff6415ULL, 0x000fc28210379aaaULL, 0x000fc4a67ae254c2ULL,
+  0x000fc6a2977ae7a3ULL, 0x000fc87aa928908bULL, 0x000fca325e4bd8d4ULL, 0x000fcbcce9021dc6ULL,
+  0x000fcd4d12f834c6ULL, 0x000fceb54d8fe7e7ULL, 0x000fd007bf1dc4c6ULL, 0x000fd1464dd6c0baULL,
+  0x000fd272a8e2f060ULL, 0x000fd38e4ff0c565ULL, 0x000fd49a9990b0f2ULL, 0x000fd598b8920bf9ULL,
+  0x000fd689c08e96bdULL, 0x000fd76ea9c8e52aULL, 0x000fd848547b0606ULL, 0x000fd9178bad29cbULL,
+  0x000fd9dd07a7ab31ULL, 0x000fda9970105c08ULL, 0x000fdb4d5dc02bb8ULL, 0x000fdbf95c5bfa83ULL,
+  0x000fdc9debb99848ULL, 0x000fdd3b8118707fULL, 0x000fddd288342d86ULL, 0x000fde6364369d6fULL,
+  0x000fdeee708d4f6dULL, 0x000fdf7401a6b25eULL, 0x000fdff46599eb80ULL, 0x000fe06fe4bc2343ULL,
+  0x000fe0e6c225a0b8ULL, 0x000fe1593c28b6baULL, 0x000fe1c78cbc3e15ULL, 0x000fe231e9db1b32ULL,
+  0x000fe29885da1a27ULL, 0x000fe2fb8fb54027ULL, 0x000fe35b33558bf6ULL, 0x000fe3b799cffee1ULL,
+  0x000fe410e99eac3fULL, 0x000fe46746d475ffULL, 0x000fe4bad34c082fULL, 0x000fe50baed29401ULL,
+  0x000fe559f74ebb5cULL, 0x000fe5a5c8e410ffULL, 0x000fe5ef3e13857dULL, 0x000fe6366fd90f74ULL,
+  0x000fe67b75c6d47cULL, 0x000fe6be661e10b4ULL, 0x000fe6ff55e5f402ULL, 0x000fe73e5900a617ULL,
+  0x000fe77b823e9d56ULL, 0x000fe7b6e3706fc3ULL, 0x000fe7f08d77416bULL, 0x000fe8289053efb9ULL,
+  0x000fe85efb35166dULL, 0x000fe893dc84079bULL, 0x000fe8c741f0cdf7ULL, 0x000fe8f9387d4e36ULL,
+  0x000fe929cc879a62ULL, 0x000fe95909d38833ULL, 0x000fe986fb9399eeULL, 0x000fe9b3ac7147b7ULL,
+  0x000fe9df2694b62aULL, 0x000fea0973abe5d4ULL, 0x000fea329cf16600ULL, 0x000fea5aab32948cULL,
+  0x000fea81a6d5737cULL, 0x000feaa797de1c56ULL, 0x000feacc85f3d889ULL, 0x000feaf07865e5a9ULL,
+  0x000feb13762feb82ULL, 0x000feb3585fe29bdULL, 0x000feb56ae316229ULL, 0x000feb76f4e28470ULL,
+  0x000feb965fe61f8dULL, 0x000febb4f4cf9cf9ULL, 0x000febd2b8f4494fULL, 0x000febefb16e2dbfULL,
+  0x000fec0be31ebd6cULL, 0x000fec2752b1599aULL, 0x000fec42049daf5bULL, 0x000fec5bfd29f121ULL,
+  0x000fec75406cee81ULL, 0x000fec8dd2500c42ULL, 0x000feca5b6911ea1ULL, 0x000fecbcf0c42790ULL,
+  0x000fecd38454faa9ULL, 0x000fece97488c84aULL, 0x000fecfec47f914fULL, 0x000fed13773584c1ULL,
+  0x000fed278f84489eULL, 0x000fed3b10242ee8ULL, 0x000fed4dfbad580bULL, 0x000fed605498c37cULL,
+  0x000fed721d414f89ULL, 0x000fed8357e4a924ULL, 0x000fed9406a42c6dULL, 0x000feda42b85b6a9ULL,
+  0x000fedb3c8746a5aULL, 0x000fedc2df4165faULL, 0x000fedd171a46dfcULL, 0x000feddf813c8a7dULL,
+  0x000feded0f90992cULL, 0x000fedfa1e0fd3c1ULL, 0x000fee06ae124b73ULL, 0x000fee12c0d959b5ULL,
+  0x000fee1e57900690ULL, 0x000fee29734b64d6ULL, 0x000fee34150ae46fULL, 0x000fee3e3db89af0ULL,
+  0x000fee47ee2982a8ULL, 0x000fee51271db03cULL, 0x000fee59e9407ef7ULL, 0x000fee623528b3e5ULL,
+  0x000fee6a0b5897a9ULL, 0x000fee716c3e0733ULL, 0x000fee7858327b3bULL, 0x000fee7ecf7b0674ULL,
+  0x000fee84d2484a6eULL, 0x000fee8a60b662ffULL, 0x000fee8f7accc80fULL, 0x000fee94207e2598ULL,
+  0x000fee9851a829aaULL, 0x000fee9c0e13481aULL, 0x000fee9f557273b4ULL, 0x000feea22762cc70ULL,
+  0x000feea4836b426dULL, 0x000feea668fc2d34ULL, 0x000feea7d76ed6bdULL, 0x000feea8ce04f9ceULL,
+  0x000feea94be83300ULL, 0x000feea9502963d4ULL, 0x000feea8d9c00723ULL, 0x000feea7e789761aULL,
+  0x000feea678481cecULL, 0x000feea48aa29e4aULL, 0x000feea21d22e4a2ULL, 0x000fee9f2e351fedULL,
+  0x000fee9bbc26aef8ULL, 0x000fee97c524f2adULL, 0x000fee93473c0a03ULL, 0x000fee8e405574e0ULL,
+  0x000fee88ae369c44ULL, 0x000fee828e7f3dc9ULL, 0x000fee7bdea7b854ULL, 0x000fee749bff37cbULL,
+  0x000fee6cc3a9bd2cULL, 0x000fee64529e004dULL, 0x000fee5b45a32857ULL, 0x000fee51994e5785ULL,
+  0x000fee474a00069eULL, 0x000fee3c53e12c1eULL, 0x000fee30b2e02aa7ULL, 0x000fee2462ad81d4ULL,
+  0x000fee175eb83c2aULL, 0x000fee09a22a1417ULL, 0x000fedfb27e3499cULL, 0x000fedebea76213eULL,
+  0x000feddbe422044fULL, 0x000fedcb0ece39a5ULL, 0x000fedb964042cc6ULL, 0x000feda6dce9389cULL,
+  0x000fed937237e95fULL, 0x000fed7f1c38a80aULL, 0x000fed69d2b9bffeULL, 0x000fed538d06add3ULL,
+  0x000fed3c41dea3f7ULL, 0x000fed23e76a2facULL, 0x000fed0a732fe617ULL, 0x000fecefda07fe08ULL,
+  0x000fecd4100eb78cULL, 0x000fecb708956e89ULL, 0x000fec98b6123096ULL, 0x000fec790a0da94eULL,
+  0x000fec57f50f31d4ULL, 0x000fec356686c938ULL, 0x000fec114cb4b30bULL, 0x000febeb948e6fa7ULL,
+  0x000febc429a0b668ULL, 0x000feb9af5ee0cb3ULL, 0x000feb6fe1c98519ULL, 0x000feb42d3ad1f75ULL,
+  0x000feb13b00b2d23ULL, 0x000feae2591a02c0ULL, 0x000feaaeae99222dULL, 0x000fea788d8ee2feULL,
+  0x000fea3fcffd73bcULL, 0x000fea044c8dd9ceULL, 0x000fe9c5d62f5612ULL, 0x000fe9843ba9477aULL,
+  0x000fe93f471d4700ULL, 0x000fe8f6bd76c5adULL, 0x000fe8aa5dc4e8bdULL, 0x000fe859e07ab1c1ULL,
+  0x000fe804f690a917ULL, 0x000fe7ab48823396ULL, 0x000fe74c751f6a7cULL, 0x000fe6e8102aa1d9ULL,
+  0x000fe67da0b6abafULL, 0x000fe60c9f383055ULL, 0x000fe5947338f718ULL, 0x000fe51470977256ULL,
+  0x000fe48bd436f42dULL, 0x000fe3f9bffd1e0dULL, 0x000fe35d35eeb171ULL, 0x000fe2b5122fe4d2ULL,
+  0x000fe2000399552bULL, 0x000fe13c827882e8ULL, 0x000fe068c4ee6783ULL, 0x000fdf82b02b717dULL,
+  0x000fde87c57efe7cULL, 0x000fdd7509c63bceULL, 0x000fdc46e529bee3ULL, 0x000fdaf8f82e0252ULL,
+  0x000fd985e1b2ba43ULL, 0x000fd7e6ef48ced0ULL, 0x000fd613adbd64d6ULL, 0x000fd40149e2efdaULL,
+  0x000fd1a1a7b4c772ULL, 0x000fcee204761f61ULL, 0x000fcba8d85e1171ULL, 0x000fc7d26ecd2cdeULL,
+  0x000fc32b2f1e22a1ULL, 0x000fbd6581c0b7e7ULL, 0x000fb606c40053d6ULL, 0x000fac40582a2805ULL,
+  0x000f9e971e014510ULL, 0x000f89fa48a41d49ULL, 0x000f66c5f7f02f1aULL, 0x000f1a5a4b331a0aULL
+};
+
+template<typename T> const double ziggurat_tables<T>::wi_normal[256] = {
+  8.6836270608283473e-16, 4.7793301741377593e-17, 6.3543524164102585e-17, 7.4548704804935243e-17,
+  8.3293668151732831e-17, 9.0680604045268064e-17, 9.7148600760968464e-17, 1.0294750313816509e-16,
+  1.0823430288059529e-16, 1.1311470195750259e-16, 1.1766359456688471e-16, 1.2193617278400444e-16,
+  1.259743991434077e-16, 1.2981099885983e-16, 1.3347203736556521e-16, 1.3697864842315511e-16,
+  1.4034823000997335e-16, 1.4359529451821483e-16, 1.4673208742137644e-16, 1.4976904668172175e-16,
+  1.5271515003384589e-16, 1.555781816925582e-16, 1.58364940090921e-16, 1.6108140175081854e-16,
+  1.6373285203782087e-16, 1.6632399058238027e-16, 1.6885901708498422e-16, 1.713417017638584e-16,
+  1.7377544365695136e-16, 1.7616331922835133e-16, 1.785081231681451e-16, 1.8081240285640384e-16,
+  1.8307848764671256e-16, 1.8530851388465636e-16, 1.8750444639224454e-16, 1.8966809700628152e-16,
+  1.9180114064694707e-16, 1.9390512930483762e-16, 1.9598150426489938e-16, 1.9803160682991647e-16,
+  2.0005668776139063e-16, 2.0205791561939557e-16, 2.04036384153502e-16, 2.0599311887275701e-16,
+  2.0792908290287945e-16, 2.0984518222246143e-16, 2.117422703563793e-16, 2.136211525932919e-16,
+  2.1548258978462456e-16, 2.1732730177446985e-16, 2.1915597050311459e-16, 2.2096924282121024e-16,
+  2.2276773304676732e-16, 2.2455202529302963e-16, 2.2632267559175672e-16, 2.280802138334151e-16,
+  2.298251455431733e-16, 2.3155795350934717e-16, 2.3327909927899507e-16, 2.3498902453367309e-16,
+  2.3668815235689126e-16, 2.3837688840352904e-16, 2.4005562198034833e-16, 2.417247270457588e-16,
+  2.4338456313612944e-16, 2.4503547622517899e-16, 2.4667779952231006e-16, 2.4831185421515809e-16,
+  2.4993795016110418e-16, 2.5155638653203404e-16, 2.5316745241621325e-16, 2.5477142738078082e-16,
+  2.5636858199803476e-16, 2.5795917833839038e-16, 2.5954347043262911e-16, 2.6112170470582226e-16,
+  2.6269412038510092e-16, 2.6426094988325525e-16, 2.6582241915997472e-16, 2.6737874806238796e-16,
+  2.6893015064642062e-16, 2.7047683548036584e-16, 2.7201900593194673e-16, 2.7355686044004848e-16,
+  2.7509059277220414e-16, 2.7662039226883326e-16, 2.7814644407515529e-16, 2.796689293616304e-16,
+  2.8118802553371588e-16, 2.8270390643166804e-16, 2.8421674252106693e-16, 2.8572670107469254e-16,
+  2.872339463463364e-16, 2.8873863973709251e-16, 2.9024093995463437e-16, 2.9174100316595041e-16,
+  2.9323898314397969e-16, 2.9473503140856054e-16, 2.9622929736207917e-16, 2.9772192842018089e-16,
+  2.9921307013788463e-16, 3.0070286633142165e-16, 3.0219145919609987e-16, 3.0367898942047899e-16,
+  3.051655962971257e-16, 3.0665141783020421e-16, 3.0813659084014336e-16, 3.0962125106561073e-16,
+  3.111055332630125e-16, 3.1258957130372778e-16, 3.1407349826927714e-16, 3.1555744654461717e-16,
+  3.1704154790974445e-16, 3.1852593362978663e-16, 3.2001073454375151e-16, 3.2149608115209942e-16,
+  3.2298210370330056e-16, 3.2446893227953307e-16, 3.2595669688167537e-16, 3.2744552751374234e-16,
+  3.2893555426691273e-16, 3.304269074032927e-16, 3.3191971743955903e-16, 3.3341411523062504e-16,
+  3.3491023205346958e-16, 3.3640819969127209e-16, 3.3790815051799441e-16, 3.3941021758355219e-16,
+  3.4091453469971958e-16, 3.4242123652691249e-16, 3.4393045866199745e-16, 3.4544233772727637e-16,
+  3.4695701146079997e-16, 3.4847461880816654e-16, 3.4999530001596677e-16, 3.5151919672703956e-16,
+  3.5304645207770958e-16, 3.5457721079718259e-16, 3.5611161930928127e-16, 3.5764982583671083e-16,
+  3.5919198050805217e-16, 3.6073823546768767e-16, 3.6228874498887499e-16, 3.6384366559019358e-16,
+  3.6540315615559934e-16, 3.6696737805833569e-16, 3.6853649528896015e-16, 3.7011067458776174e-16,
+  3.7169008558185731e-16, 3.7327490092727252e-16, 3.7486529645633009e-16, 3.764614513306871e-16,
+  3.7806354820038333e-16, 3.7967177336928472e-16, 3.8128631696733099e-16, 3.8290737313002048e-16,
+  3.8453514018559503e-16, 3.8616982085041696e-16, 3.8781162243306366e-16, 3.8946075704770047e-16,
+  3.9111744183733125e-16, 3.9278189920756777e-16, 3.9445435707160414e-16, 3.9613504910713278e-16,
+  3.9782421502599031e-16, 3.9952210085738131e-16, 4.0122895924559053e-16, 4.0294504976316317e-16,
+  4.0467063924060814e-16, 4.0640600211376089e-16, 4.0815142079003244e-16, 4.0990718603486792e-16,
+  4.1167359737984646e-16, 4.134509635539701e-16, 4.1523960293981795e-16, 4.1703984405638332e-16,
+  4.1885202607056557e-16, 4.2067649933945852e-16, 4.2251362598576456e-16, 4.2436378050887008e-16,
+  4.2622735043434475e-16, 4.2810473700487922e-16, 4.299963559159534e-16, 4.3190263809983563e-16,
+  4.3382403056185438e-16, 4.3576099727326276e-16, 4.3771402012543917e-16, 4.3968359995063508e-16,
+  4.4167025761500585e-16, 4.4367453519024474e-16, 4.4569699721079489e-16, 4.4773823202434653e-16,
+  4.4979885324415058e-16, 4.5187950131260395e-16, 4.5398084518660404e-16, 4.5610358415634541e-16,
+  4.5824844981056243e-16, 4.6041620816272361e-16, 4.6260766195439546e-16, 4.648236531539341e-16,
+  4.6706506567087898e-16, 4.6933282830895128e-16, 4.7162791798345608e-16, 4.7395136323221013e-16,
+  4.7630424805293972e-16, 4.7868771610450073e-16, 4.8110297531437273e-16, 4.8355130294078599e-16,
+  4.8603405114471714e-16, 4.8855265313499885e-16, 4.9110862995916812e-16, 4.9370359802367719e-16,
+  4.9633927744004502e-16, 4.990175013088311e-16, 5.0174022607146047e-16, 5.0450954308152693e-16,
+  5.0732769157301095e-16, 5.1019707323381559e-16, 5.1312026863034044e-16, 5.1610005577398766e-16,
+  5.1913943117543745e-16, 5.2224163379969378e-16, 5.2541017241743285e-16, 5.2864885695017039e-16,
+  5.3196183453351877e-16, 5.3535363118133128e-16, 5.3882920013308987e-16, 5.4239397821985875e-16,
+  5.4605395190716861e-16, 5.4981573508897504e-16, 5.5368666124648428e-16, 5.5767489329235749e-16,
+  5.6178955535524476e-16, 5.6604089200794866e-16, 5.7044046212884871e-16, 5.7500137689170287e-16,
+  5.7973859457217636e-16, 5.8466928934526864e-16, 5.8981331764751453e-16, 5.9519381496387295e-16,
+  6.0083796962692351e-16, 6.0677804093308186e-16, 6.1305272087226971e-16, 6.1970898945790904e-16,
+  6.2680469632988015e-16, 6.3441224071250802e-16, 6.4262396595456918e-16, 6.515603317342698e-16,
+  6.6138278850954465e-16, 6.7231504625034587e-16, 6.8468034175622373e-16, 6.9897183363857306e-16,
+  7.1599949348289484e-16, 7.3724243017973336e-16, 7.6589363708045354e-16, 8.1138493376564842e-16
+};
+
+template<typename T> const double ziggurat_tables<T>::fi_normal[256] = {
+  1.0, 0.97710170128273133, 0.95987909181241593, 0.94519895345307803,
+  0.93206007596899021, 0.91999150504836025, 0.90872644006056291, 0.89809592190630405,
+  0.88798466076339988, 0.87830965581614684, 0.86900868804379316, 0.86003362120300864,
+  0.85134625846512368, 0.84291565311844108, 0.83471629299293038, 0.82672683395209423,
+  0.8189291916094148, 0.81130787431821993, 0.80384948317638949, 0.79654233042825462,
+  0.78937614357119856, 0.7823418326598619, 0.77543130498613833, 0.76863731580333483,
+  0.76195334684154647, 0.7553735065117545, 0.74889244722372672, 0.74250529634463625,
+  0.73620759813126668, 0.72999526456580244, 0.7238645334728816, 0.7178119326349014,
+  0.71183424888235847, 0.70592850133679741, 0.7000919181404901, 0.69432191613003258,
+  0.68861608300852706, 0.68297216164879138, 0.67738803622251309, 0.67186171990076637,
+  0.66639134391238064, 0.66097514778024136, 0.65561147058322466, 0.65029874311429459,
+  0.64503548082425188, 0.63982027745643899, 0.63465179929096005, 0.62952877992812828,
+  0.62445001555027424, 0.61941436060903921, 0.6144207238920768, 0.60946806492889538,
+  0.60455539070054953, 0.59968175262216772, 0.59484624377099127, 0.59004799633579197,
+  0.58528617926630033, 0.58055999610368347, 0.57586868297521054, 0.57121150673807497,
+  0.56658776325895177, 0.56199677581727792, 0.55743789362148632, 0.55291049042851992,
+  0.54841396325792113, 0.54394773119264994, 0.53951123425954461, 0.53510393238301956,
+  0.53072530440619392, 0.5263748471741867, 0.52205207467479486, 0.51775651723220062,
+  0.51348772074974303, 0.50924524599813614, 0.50502866794582879, 0.50083757512848215,
+  0.49667156905479631, 0.49253026364614866, 0.48841328470771206, 0.4843202694289116,
+  0.48025086591124971, 0.47620473272168379, 0.47218153846988326, 0.46818096140782217,
+  0.46420268905027884, 0.46024641781492348, 0.45631185268077357, 0.4523987068638825,
+  0.44850670150921407, 0.44463556539772775, 0.44078503466776991, 0.43695485254992927,
+  0.43314476911457406, 0.42935454103134152, 0.42558393133990058, 0.4218327092313533,
+  0.41810064983968459, 0.41438753404270678, 0.41069314827198322, 0.40701728433124795,
+  0.40335973922286888, 0.39972031498193167, 0.39609881851754708, 0.39249506146101076,
+  0.3889088600204646, 0.38534003484173396, 0.38178841087503135, 0.37825381724723811,
+  0.37473608713949141, 0.37123505766982134, 0.36775056978059623, 0.3642824681305496,
+  0.36083060099117575, 0.35739482014729052, 0.35397498080156925, 0.3505709414828812,
+  0.34718256395825148, 0.34380971314829134, 0.34045225704594545, 0.33711006663841281,
+  0.33378301583210851, 0.3304709813805371, 0.32717384281495859, 0.32389148237773202,
+  0.32062378495823013, 0.3173706380312224, 0.31413193159763014, 0.31090755812756371,
+  0.30769741250555377, 0.30450139197789627, 0.30131939610203412, 0.29815132669790134,
+  0.29499708780116257, 0.29185658561828098, 0.28872972848335393, 0.28561642681665811,
+  0.28251659308484939, 0.27943014176276532, 0.27635698929678126, 0.2732970540696758,
+  0.27025025636695998, 0.26721651834463184, 0.26419576399831757, 0.26118791913376371,
+  0.25819291133864802, 0.25521066995567715, 0.25224112605694377, 0.2492842124195167,
+  0.24633986350223877, 0.24340801542371199, 0.24048860594144911, 0.23758157443217368,
+  0.23468686187325269, 0.23180441082524852, 0.22893416541557748, 0.22607607132326488,
+  0.22323007576478959, 0.22039612748101159, 0.21757417672517837, 0.2147641752520085,
+  0.21196607630785294, 0.20917983462193565, 0.20640540639867933, 0.2036427493111215,
+  0.20089182249543133, 0.19815258654653811, 0.19542500351488559, 0.19270903690432881,
+  0.19000465167119307, 0.18731181422451693, 0.18463049242750454, 0.18196065560021649,
+  0.1793022745235304, 0.17665532144440665, 0.17401977008249936, 0.17139559563815562,
+  0.16878277480185033, 0.16618128576511007, 0.16359110823298295, 0.16101222343811766,
+  0.15844461415652022, 0.15588826472506456, 0.15334316106083767, 0.15080929068241017,
+  0.14828664273312872, 0.14577520800653793, 0.14327497897404712, 0.14078594981496831,
+  0.13830811644906432, 0.13584147657175735, 0.13338602969216284, 0.13094177717412817,
+  0.12850872228047364, 0.12608687022065035, 0.1236762282020514, 0.12127680548523544,
+  0.1188886134433457, 0.11651166562603701, 0.11414597782825521, 0.11179156816424558,
+  0.10944845714721002, 0.10711666777507288, 0.10479622562286706, 0.10248715894230627,
+  0.10018949876917202, 0.097903279039215627, 0.095628536713353335, 0.093365311913026619,
+  0.091113648066700734, 0.088873592068594229, 0.086645194450867782, 0.084428509570654661,
+  0.082223595813495684, 0.080030515814947509, 0.077849336702372207, 0.075680130359194964,
+  0.073522973714240991, 0.071377949059141965, 0.069245144397250269, 0.067124653828023989,
+  0.065016577971470438, 0.062921024437977854, 0.060838108349751806, 0.058767952921137984,
+  0.056710690106399467, 0.054666461325077916, 0.052635418276973649, 0.050617723861121788,
+  0.048613553216035145, 0.046623094902089664, 0.044646552251446536, 0.042684144916619378,
+  0.040736110656078753, 0.038802707404656918, 0.036884215688691151, 0.034980941461833073,
+  0.033093219458688698, 0.03122141719202369, 0.029365939758230111, 0.027527235669693315,
+  0.025705804008632656, 0.023902203305873237, 0.022117062707379922, 0.020351096230109354,
+  0.01860512127578335, 0.016880083152595839, 0.015177088307982072, 0.013497450601780807,
+  0.011842757857943104, 0.0102149714397311, 0.0086165827694229171, 0.0070508754713921101,
+  0.005522403299264754, 0.0040379725933718715, 0.0026090727461063629, 0.001260285930498598
+};
+
+template<typename T> const uint64_t ziggurat_tables<T>::ke_exp[256] = {
+  0x001c521427248bd0ULL, 0x0000000000000000ULL, 0x00137d5bd79c2d3cULL, 0x00186ef58e3f3a72ULL,
+  0x001a9bb7320eafdcULL, 0x001bd127f71943faULL, 0x001c951d0f8864c5ULL, 0x001d1bfe2d5c393aULL,
+  0x001d7e5bd56b1888ULL, 0x001dc934dd172c50ULL, 0x001e0409dfac9db0ULL, 0x001e337b71d47820ULL,
+  0x001e5a8b177cb792ULL, 0x001e7b42096f045bULL, 0x001e970daf08ae31ULL, 0x001eaef5b14ef093ULL,
+  0x001ec3bd07b4654cULL, 0x001ed5f6f08799c4ULL, 0x001ee614ae6e567eULL, 0x001ef46eca361ccaULL,
+  0x001f014b76ddd49eULL, 0x001f0ce313a796b1ULL, 0x001f176369f1f774ULL, 0x001f20f20c45256dULL,
+  0x001f29ae1951a871ULL, 0x001f31b18fb9552fULL, 0x001f39125157c103ULL, 0x001f3fe2eb6e6948ULL,
+  0x001f463332d788f6ULL, 0x001f4c10bf1d3a0eULL, 0x001f51874c5c331fULL, 0x001f56a109c3ecbeULL,
+  0x001f5b66d9099993ULL, 0x001f5fe08210d08aULL, 0x001f6414dd445771ULL, 0x001f6809f6859676ULL,
+  0x001f6bc52a2b02e6ULL, 0x001f6f4b3d32e4f2ULL, 0x001f72a07190f13aULL, 0x001f75c8974d09d4ULL,
+  0x001f78c71b045cc0ULL, 0x001f7b9f12413ff4ULL, 0x001f7e5346079f88ULL, 0x001f80e63be21137ULL,
+  0x001f835a3dad9161ULL, 0x001f85b16056b913ULL, 0x001f87ed89b24261ULL, 0x001f8a10759374faULL,
+  0x001f8c1bba3d39adULL, 0x001f8e10cc45d048ULL, 0x001f8ff102013e17ULL, 0x001f91bd968358e1ULL,
+  0x001f9377ac47afd7ULL, 0x001f95204f8b64daULL, 0x001f96b878633891ULL, 0x001f98410c968892ULL,
+  0x001f99bae146ba81ULL, 0x001f9b26bc697f00ULL, 0x001f9c85561b717aULL, 0x001f9dd759cfd802ULL,
+  0x001f9f1d6761a1ceULL, 0x001fa058140936c1ULL, 0x001fa187eb3a3339ULL, 0x001fa2ad6f6bc4fdULL,
+  0x001fa3c91ace0683ULL, 0x001fa4db5fee6aa3ULL, 0x001fa5e4aa4d097dULL, 0x001fa6e55ee46783ULL,
+  0x001fa7dddca51ec5ULL, 0x001fa8ce7ce6a875ULL, 0x001fa9b793ce5fefULL, 0x001faa9970adb856ULL,
+  0x001fab745e588231ULL, 0x001fac48a3740585ULL, 0x001fad1682bf9feaULL, 0x001fadde3b5782c0ULL,
+  0x001faea008f21d6eULL, 0x001faf5c2418b07fULL, 0x001fb012c25b7a15ULL, 0x001fb0c41681dff5ULL,
+  0x001fb17050b6f1fbULL, 0x001fb2179eb2963aULL, 0x001fb2ba2bdfa84bULL, 0x001fb358217f4e19ULL,
+  0x001fb3f1a6c9be0bULL, 0x001fb486e10cacd7ULL, 0x001fb517f3c793feULL, 0x001fb5a500c5fdaaULL,
+  0x001fb62e2837fe58ULL, 0x001fb6b388c9010bULL, 0x001fb7353fb50798ULL, 0x001fb7b368dc7da9ULL,
+  0x001fb82e1ed6ba08ULL, 0x001fb8a57b0347f6ULL, 0x001fb919959a0f74ULL, 0x001fb98a85ba7204ULL,
+  0x001fb9f861796f27ULL, 0x001fba633deee287ULL, 0x001fbacb2f41ec17ULL, 0x001fbb3048b49145ULL,
+  0x001fbb929caea4e1ULL, 0x001fbbf23cc8029eULL, 0x001fbc4f39d22996ULL, 0x001fbca9a3e140d5ULL,
+  0x001fbd018a548fa0ULL, 0x001fbd56fbde729cULL, 0x001fbdaa068bd66bULL, 0x001fbdfab7cb3f42ULL,
+  0x001fbe491c7364deULL, 0x001fbe9540c9695fULL, 0x001fbedf3086b128ULL, 0x001fbf26f6de6175ULL,
+  0x001fbf6c9e828ae3ULL, 0x001fbfb031a904c4ULL, 0x001fbff1ba0ffdb1ULL, 0x001fc03141024589ULL,
+  0x001fc06ecf5b54b4ULL, 0x001fc0aa6d8b1428ULL, 0x001fc0e42399698bULL, 0x001fc11bf9298a65ULL,
+  0x001fc151f57d1943ULL, 0x001fc1861f770f4bULL, 0x001fc1b87d9e74b4ULL, 0x001fc1e91620ea43ULL,
+  0x001fc217eed505deULL, 0x001fc2450d3c8400ULL, 0x001fc27076864fc3ULL, 0x001fc29a2f90630eULL,
+  0x001fc2c23ce98046ULL, 0x001fc2e8a2d2c6b3ULL, 0x001fc30d654122ecULL, 0x001fc33087de9c0fULL,
+  0x001fc3520e0b7ec8ULL, 0x001fc371fadf66f8ULL, 0x001fc390512a2887ULL, 0x001fc3ad137497faULL,
+  0x001fc3c844013349ULL, 0x001fc3e1e4ccab40ULL, 0x001fc3f9f78e4da8ULL, 0x001fc4107db85061ULL,
+  0x001fc4257877fd68ULL, 0x001fc438e8b5bfc7ULL, 0x001fc44acf15112aULL, 0x001fc45b2bf447e9ULL,
+  0x001fc469ff6c4504ULL, 0x001fc477495001b3ULL, 0x001fc483092bfbb9ULL, 0x001fc48d3e457ff6ULL,
+  0x001fc495e799d21bULL, 0x001fc49d03dd30b2ULL, 0x001fc4a29179b433ULL, 0x001fc4a68e8e07fcULL,
+  0x001fc4a8f8ebfb8cULL, 0x001fc4a9ce16eaa0ULL, 0x001fc4a90b41fa36ULL, 0x001fc4a6ad4e28a1ULL,
+  0x001fc4a2b0c82e76ULL, 0x001fc49d11e62de3ULL, 0x001fc495cc852df4ULL, 0x001fc48cdc265ec1ULL,
+  0x001fc4823bec237aULL, 0x001fc475e696dee7ULL, 0x001fc467d6817e83ULL, 0x001fc458059dc038ULL,
+  0x001fc4466d702e22ULL, 0x001fc433070bcb9aULL, 0x001fc41dcb0d6e0eULL, 0x001fc406b196bbf7ULL,
+  0x001fc3edb248cb62ULL, 0x001fc3d2c43e593eULL, 0x001fc3b5de0591b5ULL, 0x001fc396f599614dULL,
+  0x001fc376005a4594ULL, 0x001fc352f3069372ULL, 0x001fc32dc1b22819ULL, 0x001fc3065fbd7888ULL,
+  0x001fc2dcbfcbf262ULL, 0x001fc2b0d3b99f9eULL, 0x001fc2828c8ffcf1ULL, 0x001fc251da79f164ULL,
+  0x001fc21eacb6d39eULL, 0x001fc1e8f18c6757ULL, 0x001fc1b09637bb3dULL, 0x001fc17586dccd0fULL,
+  0x001fc137ae74d6b8ULL, 0x001fc0f6f6bb2415ULL, 0x001fc0b348184da5ULL, 0x001fc06c898baff1ULL,
+  0x001fc022a092f365ULL, 0x001fbfd5710f72b8ULL, 0x001fbf84dd29488eULL, 0x001fbf30c52fc60bULL,
+  0x001fbed907770cc7ULL, 0x001fbe7d80327ddcULL, 0x001fbe1e094ba615ULL, 0x001fbdba7a354407ULL,
+  0x001fbd52a7b9f827ULL, 0x001fbce663c6201bULL, 0x001fbc757d2c4de5ULL, 0x001fbbffbf63b7aaULL,
+  0x001fbb84f23fe6a2ULL, 0x001fbb04d9a0d18eULL, 0x001fba7f351a70acULL, 0x001fb9f3bf92b619ULL,
+  0x001fb9622ed4abfbULL, 0x001fb8ca33174a17ULL, 0x001fb82b76765b54ULL, 0x001fb7859c5b895cULL,
+  0x001fb6d840d55594ULL, 0x001fb622f7d96943ULL, 0x001fb5654c6f37e1ULL, 0x001fb49ebfbf69d2ULL,
+  0x001fb3cec803e747ULL, 0x001fb2f4cf539c3fULL, 0x001fb21032442853ULL, 0x001fb1203e5a9604ULL,
+  0x001fb0243042e1c2ULL, 0x001faf1b31c479a6ULL, 0x001fae045767e105ULL, 0x001facde9dbf2d74ULL,
+  0x001faba8e640060aULL, 0x001faa61f399ff28ULL, 0x001fa908656f66a2ULL, 0x001fa79ab3508d3cULL,
+  0x001fa61726d1f213ULL, 0x001fa47bd48be9ffULL, 0x001fa2c693c5c095ULL, 0x001fa0f4f47df315ULL,
+  0x001f9f04336bbe0aULL, 0x001f9cf12b79f9bdULL, 0x001f9ab84415abc4ULL, 0x001f98555b782fb8ULL,
+  0x001f95c3abd03f78ULL, 0x001f92fda9cef1f2ULL, 0x001f8ffcda9ae41cULL, 0x001f8cb99e7385f7ULL,
+  0x001f892aec479605ULL, 0x001f8545f904db8dULL, 0x001f80fdc336039aULL, 0x001f7c427839e923ULL,
+  0x001f7700a3582acbULL, 0x001f71200f1a241aULL, 0x001f6a8234b73528ULL, 0x001f630000a8e263ULL,
+  0x001f5a66904fe3c0ULL, 0x001f50724ece116dULL, 0x001f44c7665c6fd5ULL, 0x001f36e5a38a599bULL,
+  0x001f261434503402ULL, 0x001f113e047b0409ULL, 0x001ef6aefa57cbdaULL, 0x001ed38ca188150bULL,
+  0x001ea2a61e122d97ULL, 0x001e5961c78b2652ULL, 0x001dddf62bac0b64ULL, 0x001cdb4dd9e4e805ULL
+};
+
+template<typename T> const double ziggurat_tables<T>::we_exp[256] = {
+  9.6557400632134428e-16, 7.089014243952849e-18, 1.1639412496689329e-17, 1.5243915123530595e-17,
+  1.8332848857236074e-17, 2.1089651094643646e-17, 2.361128077843027e-17, 2.5955957723107901e-17,
+  2.8161735541976543e-17, 3.0255041303212893e-17, 3.2255082548362859e-17, 3.417632340184942e-17,
+  3.6029969787343705e-17, 3.7824907768695708e-17, 3.9568321980974774e-17, 4.1266117781758731e-17,
+  4.2923218084424548e-17, 4.4543777432823036e-17, 4.6131339814831218e-17, 4.7688957252645725e-17,
+  4.9219280437279012e-17, 5.0724629045030866e-17, 5.2207047027926138e-17, 5.3668346617181355e-17,
+  5.5110143728350386e-17, 5.6533886732396117e-17, 5.7940880048527124e-17, 5.9332303652088901e-17,
+  6.070922932847129e-17, 6.2072634311631429e-17, 6.3423412803030284e-17, 6.476238575956094e-17,
+  6.6090309257693596e-17, 6.7407881678726779e-17, 6.8715749911837681e-17, 7.0014514734038877e-17,
+  7.1304735496606015e-17, 7.2586934224146077e-17, 7.3861599213817501e-17, 7.5129188207236886e-17,
+  7.6390131195507863e-17, 7.7644832907978099e-17, 7.8893675027297536e-17, 8.0137018166754187e-17,
+  8.1375203640417265e-17, 8.2608555052100024e-17, 8.3837379725391049e-17, 8.5061969993852886e-17,
+  8.6282604367840785e-17, 8.7499548592161505e-17, 8.8713056606902202e-17, 8.9923371422153238e-17,
+  9.1130725915978771e-17, 9.2335343563817561e-17, 9.3537439106490981e-17, 9.4737219163129188e-17,
+  9.5934882794579665e-17, 9.7130622022214904e-17, 9.8324622306494805e-17, 9.9517062989150423e-17,
+  1.007081177024292e-16, 1.0189795474846911e-16, 1.0308673745154191e-16, 1.0427462448561857e-16,
+  1.0546177017945736e-16, 1.066483248011912e-16, 1.0783443482419459e-16, 1.0902024317583479e-16,
+  1.1020588947055754e-16, 1.1139151022861948e-16, 1.1257723908165648e-16, 1.1376320696616822e-16,
+  1.1494954230590071e-16, 1.1613637118402161e-16, 1.1732381750590436e-16, 1.1851200315326675e-16,
+  1.1970104813034629e-16, 1.2089107070273833e-16, 1.2208218752947037e-16, 1.2327451378884127e-16,
+  1.2446816329851101e-16, 1.256632486302896e-16, 1.2685988122003953e-16, 1.2805817147307472e-16,
+  1.2925822886541173e-16, 1.3046016204120269e-16, 1.3166407890665704e-16, 1.3287008672073789e-16,
+  1.3407829218289975e-16, 1.3528880151811735e-16, 1.365017205594396e-16, 1.3771715482828792e-16,
+  1.3893520961270622e-16, 1.4015599004375698e-16, 1.4137960117024835e-16, 1.4260614803196637e-16,
+  1.4383573573157885e-16, 1.450684695053686e-16, 1.463044547929474e-16, 1.4754379730609499e-16,
+  1.4878660309686246e-16, 1.5003297862507355e-16, 1.5128303082535379e-16, 1.5253686717381243e-16,
+  1.5379459575449955e-16, 1.5505632532575759e-16, 1.5632216538658365e-16, 1.5759222624311752e-16,
+  1.5886661907536832e-16, 1.6014545600429157e-16, 1.6142885015932779e-16, 1.6271691574651298e-16,
+  1.6400976811727175e-16, 1.6530752383800364e-16, 1.6661030076057416e-16, 1.6791821809382284e-16,
+  1.6923139647620218e-16, 1.7054995804966293e-16, 1.7187402653490312e-16, 1.7320372730810079e-16,
+  1.7453918747925335e-16, 1.7588053597224909e-16, 1.772279036068006e-16, 1.7858142318237321e-16,
+  1.7994122956424635e-16, 1.8130745977185013e-16, 1.8268025306952518e-16, 1.8405975105985876e-16,
+  1.8544609777975692e-16, 1.8683943979941927e-16, 1.8823992632438923e-16, 1.896477093008617e-16,
+  1.9106294352443768e-16, 1.9248578675252443e-16, 1.9391639982058999e-16, 1.9535494676249096e-16,
+  1.9680159493510381e-16, 1.9825651514750198e-16, 1.9971988179493428e-16, 2.0119187299787354e-16,
+  2.0267267074641993e-16, 2.0416246105035898e-16, 2.0566143409519189e-16, 2.071697844044738e-16,
+  2.086877110088161e-16, 2.1021541762192938e-16, 2.1175311282410771e-16, 2.1330101025357806e-16,
+  2.1485932880616648e-16, 2.1642829284376062e-16, 2.1800813241207855e-16, 2.1959908346828725e-16,
+  2.2120138811904979e-16, 2.2281529486961825e-16, 2.2444105888463101e-16, 2.2607894226131752e-16,
+  2.2772921431586225e-16, 2.2939215188373128e-16, 2.3106803963482153e-16, 2.3275717040435366e-16,
+  2.3445984554049598e-16, 2.361763752697776e-16, 2.3790707908142787e-16, 2.3965228613186255e-16,
+  2.4141233567062948e-16, 2.4318757748922574e-16, 2.4497837239430722e-16, 2.4678509270692907e-16,
+  2.4860812278958537e-16, 2.5044785960295585e-16, 2.5230471329442185e-16, 2.5417910782058137e-16,
+  2.5607148160617722e-16, 2.5798228824205324e-16, 2.5991199722497484e-16, 2.6186109474239262e-16,
+  2.6383008450549448e-16, 2.6581948863418476e-16, 2.6782984859795276e-16, 2.6986172621694914e-16,
+  2.719157047279821e-16, 2.7399238992058173e-16, 2.7609241134876191e-16, 2.7821642362464385e-16,
+  2.8036510780069859e-16, 2.8253917284802561e-16, 2.847393572388177e-16, 2.8696643064198206e-16,
+  2.8922119574179986e-16, 2.9150449019052966e-16, 2.9381718870700321e-16, 2.9616020533454696e-16,
+  2.9853449587300492e-16, 3.0094106050126221e-16, 3.0338094660850069e-16, 3.0585525185448648e-16,
+  3.0836512748153144e-16, 3.1091178190342708e-16, 3.134964845996668e-16, 3.1612057034671107e-16,
+  3.187854438219718e-16, 3.2149258462068023e-16, 3.2424355273094571e-16, 3.2703999451822464e-16,
+  3.2988364927722896e-16, 3.3277635641716783e-16, 3.357200633553251e-16, 3.3871683420455121e-16,
+  3.4176885935256439e-16, 3.4487846604534313e-16, 3.4804813010374497e-16, 3.5128048892229873e-16,
+  3.5457835592247998e-16, 3.5794473666042849e-16, 3.6138284682190695e-16, 3.6489613237645519e-16,
+  3.6848829220956307e-16, 3.7216330360802176e-16, 3.7592545104162669e-16, 3.7977935876688852e-16,
+  3.837300278789225e-16, 3.8778287856079071e-16, 3.9194379843114412e-16, 3.9621919807867878e-16,
+  4.0061607510565555e-16, 4.0514208829565875e-16, 4.0980564389030773e-16, 4.1461599642909199e-16,
+  4.1958336720734147e-16, 4.2471908418244013e-16, 4.3003574816674875e-16, 4.3554743146939698e-16,
+  4.4126991690360891e-16, 4.472209874259952e-16, 4.5342077985658552e-16, 4.5989222049059542e-16,
+  4.6666156647114994e-16, 4.7375908532625177e-16, 4.8121991728292646e-16, 4.8908518273922385e-16,
+  4.9740342361919703e-16, 5.0623250721441922e-16, 5.1564218288781185e-16, 5.2571758020223133e-16,
+  5.365640977112063e-16, 5.4831440342587503e-16, 5.6113874546752109e-16, 5.7526064815033899e-16,
+  5.9098176416521681e-16, 6.0872314161809836e-16, 6.2909790348776448e-16, 6.5304920535641463e-16,
+  6.8213930790290608e-16, 7.1924449660895371e-16, 7.7060953500323561e-16, 8.5455170385845126e-16
+};
+
+template<typename T> const double ziggurat_tables<T>::fe_exp[256] = {
+  1.0, 0.93814368086219635, 0.9004699299257618, 0.87170433238121592,
+  0.84778550062400004, 0.82699329664305943, 0.80842165152301648, 0.79152763697250306,
+  0.77595685204012244, 0.76146338884990261, 0.7478686219852011, 0.73503809243142915,
+  0.72286765959357735, 0.71127476080508101, 0.70019265508279294, 0.68956649611708254,
+  0.67935057226476969, 0.66950631673192884, 0.66000084107900359, 0.65080583341457476,
+  0.64189671642726964, 0.63325199421436951, 0.6248527387036692, 0.61668218091521076,
+  0.60872538207962512, 0.60096896636523522, 0.59340090169173632, 0.58601031847727081,
+  0.57878735860284769, 0.57172304866482837, 0.56480919291240272, 0.55803828226258989,
+  0.55140341654064362, 0.54489823767244183, 0.53851687200286402, 0.53225388026304532,
+  0.52610421398362173, 0.52006317736823549, 0.51412639381475045, 0.50828977641064466,
+  0.5025495018413495, 0.49690198724155127, 0.4913438695940342, 0.48587198734188652,
+  0.48048336393045576, 0.47517519303737887, 0.46994482528396148, 0.46478975625042762,
+  0.45970761564213908, 0.45469615747461684, 0.44975325116275633, 0.44487687341454984,
+  0.44006510084235517, 0.43531610321563785, 0.43062813728846006, 0.42599954114303556,
+  0.4214287289976178, 0.41691418643300404, 0.41245446599716229, 0.40804818315203345,
+  0.40369401253053133, 0.39939068447523213, 0.39513698183329116, 0.39093173698479811,
+  0.38677382908413865, 0.38266218149601078, 0.37859575940958173, 0.37457356761590305,
+  0.37059464843514689, 0.36665807978151504, 0.36276297335481866, 0.35890847294875056,
+  0.35509375286678818, 0.351318016437484, 0.34758049462163765, 0.34388044470450307,
+  0.34021714906678069, 0.33658991402867827, 0.33299806876180965, 0.32944096426413705,
+  0.32591797239355691, 0.32242848495608983, 0.31897191284495791, 0.31554768522712956,
+  0.31215524877418016, 0.30879406693456074, 0.30546361924459081, 0.30216340067569408,
+  0.29889292101558229, 0.2956517042812617, 0.29243928816189307, 0.28925522348967819,
+  0.28609907373707727, 0.28297041453878119, 0.27986883323697331, 0.27679392844851775,
+  0.27374530965280336, 0.27072259679906047, 0.26772541993204524, 0.26475341883506259,
+  0.26180624268936331, 0.25888354974901656, 0.25598500703041571, 0.25311029001562979,
+  0.25025908236886263, 0.24743107566532793, 0.24462596913189236, 0.24184346939887746,
+  0.23908329026244937, 0.23634515245705984, 0.23362878343743348, 0.23093391716962755,
+  0.22826029393071681, 0.22560766011668415, 0.22297576805812028, 0.22036437584335958,
+  0.21777324714870061, 0.21520215107537877, 0.21265086199297836, 0.21011915938898837,
+  0.20760682772422212, 0.20511365629383779, 0.2026394390937091, 0.20018397469191135,
+  0.19774706610509893, 0.19532852067956327, 0.19292814997677141, 0.19054576966319545,
+  0.18818119940425435, 0.18583426276219714, 0.18350478709776744, 0.18119260347549626,
+  0.17889754657247828, 0.17661945459049483, 0.17435816917135341, 0.17211353531531998,
+  0.16988540130252755, 0.16767361861725008, 0.16547804187493589, 0.16329852875190168,
+  0.1611349399175919, 0.15898713896931407, 0.15685499236936509, 0.15473836938446794,
+  0.15263714202744272, 0.15055118500103976, 0.14848037564386662, 0.14642459387834475,
+  0.14438372216063458, 0.14235764543247201, 0.14034625107486226, 0.13834942886358001,
+  0.13636707092642864, 0.13439907170221341, 0.13244532790138733, 0.13050573846833061,
+  0.12858020454522801, 0.1266686294375105, 0.12477091858083077, 0.12288697950954494,
+  0.12101672182667463, 0.11916005717532749, 0.11731689921155537, 0.11548716357863334,
+  0.11367076788274413, 0.11186763167005613, 0.11007767640518522, 0.1083008254510336,
+  0.10653700405000148, 0.10478613930657001, 0.10304816017125756, 0.10132299742595349,
+  0.099610583670637007, 0.097910853311492074, 0.096223742550432659, 0.094549189376055692,
+  0.092887133556043361, 0.091237516631039961, 0.089600281910032678, 0.087975374467270037,
+  0.086362741140756732, 0.084762330532367952, 0.083174093009632216, 0.081597980709237239,
+  0.080033947542319725, 0.078481949201606227, 0.076941943170480309, 0.075413888734058201,
+  0.073897746992364552, 0.07239348087570853, 0.070901055162371593, 0.069420436498728505,
+  0.067951593421936365, 0.066494496385339552, 0.065049117786753541, 0.063615431999807098,
+  0.062193415408540759, 0.06078304644547939, 0.059384305633420016, 0.057997175631200402,
+  0.05662164128374262, 0.055257689676696788, 0.053905310196045816, 0.052564494593071408,
+  0.051235237055125983, 0.049917534282706066, 0.048611385573379198, 0.047316792913181249,
+  0.046033761076174871, 0.044762297732942991, 0.043502413568887892, 0.042254122413315935,
+  0.041017441380414528, 0.03979239102337382, 0.038578995503074545, 0.037377282772959049,
+  0.03618728478193111, 0.035009037697397091, 0.033842582150874011, 0.032687963508959222,
+  0.031545232172893289, 0.030414443910466285, 0.029295660224637071, 0.028188948763978306,
+  0.027094383780955467, 0.026012046645133884, 0.024942026419731454, 0.023884420511557845,
+  0.022839335406384914, 0.021806887504283261, 0.020787204072577802, 0.019780424338009424,
+  0.018786700744695708, 0.017806200410911039, 0.016839106826039625, 0.015885621839972847,
+  0.014945968011690829, 0.014020391403181618, 0.013109164931254677, 0.012212592426255064,
+  0.011331013597834288, 0.010464810181029675, 0.0096144136425019046, 0.0087803149858086734,
+  0.0079630774380167399, 0.0071633531836346855, 0.0063819059373188833, 0.005619642207205189,
+  0.0048776559835421052, 0.0041572951208335126, 0.0034602647778366304, 0.0027887987935738107,
+  0.0021459677437186517, 0.0015362997803013297, 0.00096726928232694837, 0.00045413435384129814
+};
+
+/**
+ * Returns a random number from the standard normal distribution with the Ziggurat method.
+ * One 64-bit random integer gives the layer, the sign and the mantissa, and the sample is accepted
+ * without evaluating any transcendental function in about 99% of the calls.
+ */
+template<class Rng> double ziggurat_standard_normal(Rng& rng) {
+  typedef ziggurat_tables<> tbl;
+  for (;;) {
+    uint64_t r = next_uint64(rng);
+    const int idx = static_cast<int>(r & 0xff);
+    r >>= 8;
+    const bool neg = (r & 1) != 0;
+    const uint64_t rabs = (r >> 1) & 0x000fffffffffffffULL;
+    double x = static_cast<double>(rabs) * tbl::wi_normal[idx];
+    if (neg) x = -x;
+    if (rabs < tbl::ki_normal[idx]) return x;
+    if (idx == 0) {
+      // sample from the tail beyond r_normal by the method of Marsaglia.
+      for (;;) {
+        const double xx = -std::log1p(-next_double(rng)) / tbl::r_normal;
+        const double yy = -std::log1p(-next_double(rng));
+        if (yy + yy > xx * xx) return neg ? -(tbl::r_normal + xx) : tbl::r_normal + xx;
+      }
+    }
+    if ((tbl::fi_normal[idx - 1] - tbl::fi_normal[idx]) * next_double(rng) + tbl::fi_normal[idx] < std::exp(-0.5 * x * x)) return x;
+  }
+}
+
+/**
+ * Returns a random number from the standard exponential distribution with the Ziggurat method.
+ * One 64-bit random integer gives the layer and the mantissa, and the logarithm is evaluated
+ * only for the samples from the tail or from the wedges.
+ */
+template<class Rng> double ziggurat_standard_exponential(Rng& rng) {
+  typedef ziggurat_tables<> tbl;
+  for (;;) {
+    uint64_t r = next_uint64(rng) >> 3;
+    const int idx = static_cast<int>(r & 0xff);
+    r >>= 8;
+    const double x = static_cast<double>(r) * tbl::we_exp[idx];
+    if (r < tbl::ke_exp[idx]) return x;
+    // the tail of the exponential distribution is the exponential distribution shifted by r_exp.
+    if (idx == 0) return tbl::r_exp - std::log1p(-next_double(rng));
+    if ((tbl::fe_exp[idx - 1] - tbl::fe_exp[idx]) * next_double(rng) + tbl::fe_exp[idx] < std::exp(-x)) return x;
+  }
+}
+
+// Returns a positive random number from the standard exponential distribution, for the samplers that take its logarithm.
+template<class Rng> double ziggurat_positive_exponential(Rng& rng) {
+  for (;;) {
+    const double x = ziggurat_standard_exponential(rng);
+    if (x > 0) return x;
+  }
+}
+
+/**
+ * Normal distribution sampled with the Ziggurat method. It has the same interface as std::normal_distribution.
+ * The samples are computed in double precision and then converted to RealType.
+ */
+template<typename RealType = double> class ziggurat_normal_distribution {
+public:
+  typedef RealType result_type;
+
+  explicit ziggurat_normal_distribution(const RealType mean = 0, const RealType stddev = 1) : mean_(mean), stddev_(stddev) {}
+
+  RealType mean() const {
+    return mean_;
+  }
+
+  RealType stddev() const {
+    return stddev_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    return static_cast<RealType>(static_cast<double>(mean_) + static_cast<double>(stddev_) * ziggurat_standard_normal(rng));
+  }
+
+private:
+  RealType mean_;
+  RealType stddev_;
+};
+
+/**
+ * Lognormal distribution whose logarithm is sampled with the Ziggurat method.
+ * It has the same interface as std::lognormal_distribution.
+ */
+template<typename RealType = double> class ziggurat_lognormal_distribution {
+public:
+  typedef RealType result_type;
+
+  explicit ziggurat_lognormal_distribution(const RealType m = 0, const RealType s = 1) : m_(m), s_(s) {}
+
+  RealType m() const {
+    return m_;
+  }
+
+  RealType s() const {
+    return s_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    return static_cast<RealType>(std::exp(static_cast<double>(m_) + static_cast<double>(s_) * ziggurat_standard_normal(rng)));
+  }
+
+private:
+  RealType m_;
+  RealType s_;
+};
+
+/**
+ * Exponential distribution sampled with the Ziggurat method.
+ * It has the same interface as std::exponential_distribution.
+ */
+template<typename RealType = double> class ziggurat_exponential_distribution {
+public:
+  typedef RealType result_type;
+
+  explicit ziggurat_exponential_distribution(const RealType lambda = 1) : lambda_(lambda) {}
+
+  RealType lambda() const {
+    return lambda_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    return static_cast<RealType>(ziggurat_standard_exponential(rng) / static_cast<double>(lambda_));
+  }
+
+private:
+  RealType lambda_;
+};
+
+/**
+ * Extreme value (Gumbel) distribution computed as a - b * log(E), where E follows the standard exponential
+ * distribution sampled with the Ziggurat method. It has the same interface as std::extreme_value_distribution.
+ */
+template<typename RealType = double> class ziggurat_extreme_value_distribution {
+public:
+  typedef RealType result_type;
+
+  explicit ziggurat_extreme_value_distribution(const RealType a = 0, const RealType b = 1) : a_(a), b_(b) {}
+
+  RealType a() const {
+    return a_;
+  }
+
+  RealType b() const {
+    return b_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    return static_cast<RealType>(static_cast<double>(a_) - static_cast<double>(b_) * std::log(ziggurat_positive_exponential(rng)));
+  }
+
+private:
+  RealType a_;
+  RealType b_;
+};
+
+/**
+ * Weibull distribution computed as b * E^(1 / a), where E follows the standard exponential distribution
+ * sampled with the Ziggurat method. It has the same interface as std::weibull_distribution.
+ */
+template<typename RealType = double> class ziggurat_weibull_distribution {
+public:
+  typedef RealType result_type;
+
+  explicit ziggurat_weibull_distribution(const RealType a = 1, const RealType b = 1) : a_(a), b_(b), inv_a_(1.0 / static_cast<double>(a)) {}
+
+  RealType a() const {
+    return a_;
+  }
+
+  RealType b() const {
+    return b_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    return static_cast<RealType>(static_cast<double>(b_) * std::pow(ziggurat_standard_exponential(rng), inv_a_));
+  }
+
+private:
+  RealType a_;
+  RealType b_;
+  double inv_a_;
+};
+
+/**
+ * Cauchy distribution sampled as the ratio of two standard normal random numbers drawn with the Ziggurat method,
+ * which needs no trigonometric function. It has the same interface as std::cauchy_distribution.
+ */
+template<typename RealType = double> class ziggurat_cauchy_distribution {
+public:
+  typedef RealType result_type;
+
+  explicit ziggurat_cauchy_distribution(const RealType a = 0, const RealType b = 1) : a_(a), b_(b) {}
+
+  RealType a() const {
+    return a_;
+  }
+
+  RealType b() const {
+    return b_;
+  }
+
+  void reset() {}
+
+  template<class Rng> result_type operator()(Rng& rng) {
+    const double num = ziggurat_standard_normal(rng);
+    const double den = ziggurat_standard_normal(rng);
+    return static_cast<RealType>(static_cast<double>(a_) + static_cast<double>(b_) * (num / den));
+  }
+
+private:
+  RealType a_;
+  RealType b_;
+};
+
+#endif /* NUMO_RANDOM_ZIGGURAT_HPP */
@@ -16,6 +16,24 @@ module Numo
     #   # Numo::DFloat#shape=[2,5]
     #   # [[1.90546, -0.543299, 0.673332, 0.759583, -0.40945],
     #   #  [0.334635, -0.0558342, 1.28115, 1.93644, -0.0689543]]
+    #
+    # The parameters of the distributions can also be given as Numo::DFloat,
+    # which is broadcast to the shape of random array to give the parameters of each element.
+    #
+    #   # the first column is drawn around -10, and the second one around 10.
+    #   y = rng.normal(shape: [3, 2], loc: Numo::DFloat[-10, 10], scale: 0.1)
+    #
+    # The random values can also be written to a preallocated array or its view with the out keyword,
+    # so that a loop drawing random numbers on every iteration does not allocate a new array each time.
+    # The shape and type of random array are taken from the given array unless shape and dtype are given.
+    #
+    #   buf = Numo::DFloat.new(3, 2)
+    #   rng.normal(out: buf)
+    #
+    # Large arrays are filled without the GVL, so that the filling can be interrupted by Thread#raise or a signal.
+    # If the interrupt handler returns without raising an exception, the filling starts over from the state
+    # that the generator reached when it was interrupted, so the values of that call are not reproducible from the seed.
+    # The interrupt handler cannot draw random numbers from the generator being filled, which raises ThreadError.
     class Generator # rubocop:disable Metrics/ClassLength
       # Returns random number generation algorithm.
       # @return [String]
@@ -23,19 +41,54 @@ module Numo
 
       # Creates a new random number generator.
       #
-      # @param seed [Integer] random seed used to initialize the random number generator.
-      # @param algorithm [String] random number generation algorithm ('mt32', 'mt64', 'pcg32', and 'pcg64').
-      def initialize(seed: nil, algorithm: 'pcg64') # rubocop:disable Metrics/MethodLength
+      # @param seed [Integer | Array<Integer> | SeedSequence] random seed used to initialize the random number generator.
+      #   An array of integers is mixed into the state through SeedSequence.
+      #   If nil is given, the state is initialized from a SeedSequence with fresh entropy.
+      # @param algorithm [String] random number generation algorithm
+      #   ('mt32', 'mt64', 'pcg32', 'pcg64', 'pcg64_fast', 'pcg64_k1024', 'pcg32x8', 'xoshiro256', 'philox4x32', and 'philox4x64').
+      #   'pcg64_fast' uses the cheaper multiplicative congruential step of PCG64 for speed,
+      #   and 'pcg64_k1024' extends PCG64 with a table of 1024 words to be 1024-dimensionally equidistributed.
+      #   'pcg32x8' runs eight PCG32 generators in lockstep with SIMD instructions when the CPU supports AVX2.
+      # @param stream [Integer] stream of random number sequence,
+      #   which is available only with the 'pcg32', 'pcg64', and 'pcg64_k1024' algorithms.
+      #   Generators with the same seed and different streams produce independent sequences.
+      # @param kernel_version [Integer] version of the sampling algorithms that the results are expected to be generated with.
+      #   All distributions are sampled with in-house algorithms that do not depend on the C++ standard library,
+      #   so the same seed gives the same values on every platform as long as KERNEL_VERSION is the same.
+      #   If the given version differs from KERNEL_VERSION, ArgumentError is raised instead of generating different values.
+      def initialize(seed: nil, algorithm: 'pcg64', stream: nil, kernel_version: nil) # rubocop:disable Metrics/AbcSize, Metrics/CyclomaticComplexity, Metrics/MethodLength, Metrics/PerceivedComplexity
+        if !kernel_version.nil? && kernel_version != KERNEL_VERSION
+          raise ArgumentError, "Numo::Random::Generator does not support kernel version #{kernel_version}, " \
+                               "the current version is #{KERNEL_VERSION}"
+        end
+
         @algorithm = algorithm.to_s
+        seed = SeedSequence.new(entropy: seed) if seed.is_a?(Array)
+        if !stream.nil? && !%w[pcg32 pcg64 pcg64_k1024].include?(@algorithm)
+          raise ArgumentError, "Numo::Random::Generator does not support stream with '#{@algorithm}' algorithm"
+        end
+
         @rng = case @algorithm
                when 'mt32'
                  MT32.new(seed: seed)
                when 'mt64'
                  MT64.new(seed: seed)
                when 'pcg32'
-                 PCG32.new(seed: seed)
+                 PCG32.new(seed: seed, stream: stream)
                when 'pcg64'
-                 PCG64.new(seed: seed)
+                 PCG64.new(seed: seed, stream: stream)
+               when 'pcg64_fast'
+                 PCG64Fast.new(seed: seed)
+               when 'pcg64_k1024'
+                 PCG64K1024.new(seed: seed, stream: stream)
+               when 'pcg32x8'
+                 PCG32x8.new(seed: seed)
+               when 'xoshiro256'
+                 Xoshiro256.new(seed: seed)
+               when 'philox4x32'
+                 Philox4x32.new(seed: seed)
+               when 'philox4x64'
+                 Philox4x64.new(seed: seed)
                else
                  raise ArgumentError, "Numo::Random::Generator does not support '#{@algorithm}' algorithm"
                end
@@ -43,18 +96,75 @@ module Numo
 
       # Returns the seed of random number generator.
       #
-      # @return [Integer]
+      # @return [Integer | SeedSequence]
       def seed
         rng.seed
       end
 
       # Sets the seed of random number generator.
       #
-      # @param val [Integer] random seed.
+      # @param val [Integer | Array<Integer> | SeedSequence] random seed.
       def seed=(val)
+        val = SeedSequence.new(entropy: val) if val.is_a?(Array)
+        @seed_seq = nil
         rng.seed = val
       end
 
+      # Creates new random number generators that are independent of this generator and of each other.
+      # The child generators use the same algorithm, and are seeded with the seed sequences spawned from
+      # the seed of this generator. An Integer seed is converted to SeedSequence before spawning,
+      # where a negative seed is taken as its 64-bit two's complement, the bits that the engine is seeded with.
+      #
+      # @example
+      #   require 'numo/random'
+      #
+      #   rng = Numo::Random::Generator.new(seed: 42)
+      #   children = rng.spawn(4)
+      #   x = children.map { |child| child.uniform(shape: 100) }
+      #
+      # @param n [Integer] number of child generators.
+      # @return [Array<Generator>]
+      def spawn(n)
+        @seed_seq ||= seed.is_a?(SeedSequence) ? seed : SeedSequence.new(entropy: seed & (2**64 - 1))
+        @seed_seq.spawn(n).map { |child_seq| self.class.new(seed: child_seq, algorithm: @algorithm) }
+      end
+
+      # Returns the number of threads used to fill arrays with random numbers.
+      #
+      # @return [Integer]
+      def threads
+        rng.threads
+      end
+
+      # Sets the number of threads used to fill arrays with random numbers.
+      # Arrays are filled in parallel only with the PCG ('pcg32', 'pcg64', 'pcg64_fast', 'pcg64_k1024', and 'pcg32x8')
+      # and Philox ('philox4x32' and 'philox4x64') algorithms,
+      # and only for distributions that draw a fixed number of random numbers per value, such as uniform.
+      # The generated values do not depend on the number of threads.
+      #
+      # @param val [Integer] number of threads.
+      def threads=(val)
+        rng.threads = val
+      end
+
+      # Advances the internal state of random number generator by the given number of steps.
+      # This method is available only with the 'pcg32', 'pcg64', 'pcg64_fast', 'pcg64_k1024', 'philox4x32', and 'philox4x64' algorithms,
+      # and moves the state without generating the skipped random numbers,
+      # in logarithmic time for PCG and in constant time for Philox.
+      #
+      # @example
+      #   require 'numo/random'
+      #
+      #   rng = Numo::Random::Generator.new(seed: 42)
+      #   rng.advance(2**100)
+      #
+      # @param delta [Integer] number of steps; a negative value moves the state backward.
+      def advance(delta)
+        raise NotImplementedError, "Numo::Random::Generator does not support advance with '#{@algorithm}' algorithm" unless rng.respond_to?(:advance)
+
+        rng.advance(delta)
+      end
+
       # Returns random number with uniform distribution in the half-open interval [0, 1).
       #
       # @example
@@ -68,20 +178,97 @@ module Numo
         rng.random
       end
 
-      # Generates array consists of random values according to the Bernoulli distribution.
+      # Shuffles the array in-place along the given axis.
+      # The subarrays along the axis are moved as a whole, so each of them keeps its contents.
       #
       # @example
       #   require 'numo/random'
       #
       #   rng = Numo::Random::Generator.new(seed: 42)
-      #   x = rng.bernoulli(shape: 1000, p: 0.4)
+      #   x = Numo::DFloat.new(5, 3).seq
+      #   rng.shuffle(x)
+      #
+      # @param x [Numo::NArray] array to be shuffled.
+      # @param axis [Integer] axis along which the array is shuffled.
+      # @return [Numo::NArray] the given array.
+      def shuffle(x, axis: 0)
+        rng.shuffle(x, axis: axis)
+        x
+      end
+
+      # Generates array consists of a random permutation of the integers from 0 to n - 1.
+      #
+      # @example
+      #   require 'numo/random'
+      #
+      #   rng = Numo::Random::Generator.new(seed: 42)
+      #   idx = rng.permutation(10)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param p [Float] probability of success.
+      # @param n [Integer] number of integers. If nil, the size of out is used.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :int64 if out is not given.
+      # @param out [Numo::IntX | Numo::UIntX] array to be filled with the permutation instead of a new array.
+      #   Its type and size must be the same as the ones given by dtype and n if they are given.
       # @return [Numo::IntX | Numo::UIntX]
-      def bernoulli(shape:, p:, dtype: :int32)
-        binomial(shape: shape, n: 1, p: p, dtype: dtype)
+      def permutation(n = nil, dtype: nil, out: nil)
+        x = output_array(n, dtype, out, :int64)
+        rng.permutation(x)
+        x
+      end
+
+      # Generates array consists of random samples from the given candidates.
+      #
+      # @example
+      #   require 'numo/random'
+      #
+      #   rng = Numo::Random::Generator.new(seed: 42)
+      #   # 5 distinct indices out of one million, sampled in O(5) time and memory.
+      #   idx = rng.choice(1_000_000, size: 5, replace: false)
+      #   # 2 distinct elements drawn with the given probabilities.
+      #   y = rng.choice(Numo::DFloat[1, 2, 3, 4], size: 2, replace: false, p: Numo::DFloat[0.1, 0.2, 0.3, 0.4])
+      #
+      # @param a [Integer | Numo::NArray] number of candidates, whose indices from 0 to a - 1 are sampled,
+      #   or 1-dimensional array whose elements are sampled.
+      # @param size [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param replace [Boolean] whether the samples are drawn with replacement. Without replacement, the indices are
+      #   sampled with Floyd's algorithm or the partial Fisher-Yates shuffle if p is not given, and with
+      #   the exponential keys of Efraimidis and Spirakis if p is given.
+      # @param p [Numo::DFloat | Numo::SFloat | Numo::Random::AliasTable] (shape: [n]) weights of the candidates,
+      #   which need not sum to 1. The alias table is only accepted with replacement.
+      #   If nil, the candidates are sampled uniformly.
+      # @param dtype [Symbol] data type of the sampled indices.
+      #   If nil, the type of out is used, or :int64 if out is not given.
+      # @param out [Numo::IntX | Numo::UIntX] array to be filled with the sampled indices instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and size if they are given.
+      # @return [Numo::IntX | Numo::UIntX | Numo::NArray] the sampled indices, or the sampled elements of a.
+      def choice(a, size: nil, replace: true, p: nil, dtype: nil, out: nil)
+        x = output_array(size, dtype, out, :int64)
+        rng.choice(x, n: a.is_a?(Numo::NArray) ? a.size : a, replace: replace, weight: p)
+        a.is_a?(Numo::NArray) ? a[x] : x
+      end
+
+      # Generates array consists of random values according to the Bernoulli distribution.
+      #
+      # @example
+      #   require 'numo/random'
+      #
+      #   rng = Numo::Random::Generator.new(seed: 42)
+      #   x = rng.bernoulli(shape: 1000, p: 0.4)
+      #
+      #   # The bit array stores the results in packed bits, such as a dropout mask.
+      #   mask = rng.bernoulli(shape: [64, 1024], p: 0.5, dtype: :bit)
+      #
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param p [Float | Numo::DFloat] probability of success.
+      # @param dtype [Symbol] data type of random array. If :bit is given, Numo::Bit is returned.
+      #   If nil, the type of out is used, or :int32 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
+      # @return [Numo::IntX | Numo::UIntX | Numo::Bit]
+      def bernoulli(p:, shape: nil, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :int32)
+        rng.bernoulli(x, p: p)
+        x
       end
 
       # Generates array consists of random values according to a binomial distribution.
@@ -92,13 +279,16 @@ module Numo
       #   rng = Numo::Random::Generator.new(seed: 42)
       #   x = rng.binomial(shape: 1000, n: 10, p: 0.4)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param n [Integer] number of trials.
-      # @param p [Float] probability of success.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param n [Integer | Numo::DFloat] number of trials.
+      # @param p [Float | Numo::DFloat] probability of success.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :int32 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::IntX | Numo::UIntX]
-      def binomial(shape:, n:, p:, dtype: :int32)
-        x = klass(dtype).new(shape)
+      def binomial(n:, p:, shape: nil, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :int32)
         rng.binomial(x, n: n, p: p)
         x
       end
@@ -111,13 +301,16 @@ module Numo
       #   rng = Numo::Random::Generator.new(seed: 42)
       #   x = rng.negative_binomial(shape: 1000, n: 10, p: 0.4)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param n [Integer] number of trials.
-      # @param p [Float] probability of success.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param n [Integer | Numo::DFloat] number of trials.
+      # @param p [Float | Numo::DFloat] probability of success.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :int32 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::IntX | Numo::UIntX]
-      def negative_binomial(shape:, n:, p:, dtype: :int32)
-        x = klass(dtype).new(shape)
+      def negative_binomial(n:, p:, shape: nil, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :int32)
         rng.negative_binomial(x, n: n, p: p)
         x
       end
@@ -130,12 +323,15 @@ module Numo
       #   rng = Numo::Random::Generator.new(seed: 42)
       #   x = rng.geometric(shape: 1000, p: 0.4)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param p [Float] probability of success on each trial.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param p [Float | Numo::DFloat] probability of success on each trial.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :int32 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::IntX | Numo::UIntX]
-      def geometric(shape:, p:, dtype: :int32)
-        x = klass(dtype).new(shape)
+      def geometric(p:, shape: nil, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :int32)
         rng.geometric(x, p: p)
         x
       end
@@ -148,12 +344,15 @@ module Numo
       #   rng = Numo::Random::Generator.new
       #   x = rng.exponential(shape: 100, scale: 2)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param scale [Float] scale parameter, lambda = 1.fdiv(scale).
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param scale [Float | Numo::DFloat] scale parameter, lambda = 1.fdiv(scale).
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :float64 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::DFloat | Numo::SFloat]
-      def exponential(shape:, scale: 1.0, dtype: :float64)
-        x = klass(dtype).new(shape)
+      def exponential(shape: nil, scale: 1.0, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :float64)
         rng.exponential(x, scale: scale)
         x
       end
@@ -166,13 +365,16 @@ module Numo
       #   rng = Numo::Random::Generator.new
       #   x = rng.gamma(shape: 100, k: 9, scale: 0.5)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param k [Float] shape parameter.
-      # @param scale [Float] scale parameter.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param k [Float | Numo::DFloat] shape parameter.
+      # @param scale [Float | Numo::DFloat] scale parameter.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :float64 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::DFloat | Numo::SFloat]
-      def gamma(shape:, k:, scale: 1.0, dtype: :float64)
-        x = klass(dtype).new(shape)
+      def gamma(k:, shape: nil, scale: 1.0, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :float64)
         rng.gamma(x, k: k, scale: scale)
         x
       end
@@ -185,13 +387,16 @@ module Numo
       #   rng = Numo::Random::Generator.new
       #   x = rng.gumbel(shape: 100, loc: 0.0, scale: 1.0)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param loc [Float] location parameter.
-      # @param scale [Float] scale parameter.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param loc [Float | Numo::DFloat] location parameter.
+      # @param scale [Float | Numo::DFloat] scale parameter.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :float64 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::DFloat | Numo::SFloat]
-      def gumbel(shape:, loc: 0.0, scale: 1.0, dtype: :float64)
-        x = klass(dtype).new(shape)
+      def gumbel(shape: nil, loc: 0.0, scale: 1.0, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :float64)
         rng.gumbel(x, loc: loc, scale: scale)
         x
       end
@@ -204,12 +409,15 @@ module Numo
       #   rng = Numo::Random::Generator.new(seed: 42)
       #   x = rng.poisson(shape: 1000, mean: 4)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param mean [Float] mean of poisson distribution.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param mean [Float | Numo::DFloat] mean of poisson distribution.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :int32 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::IntX | Numo::UIntX]
-      def poisson(shape:, mean: 1.0, dtype: :int32)
-        x = klass(dtype).new(shape)
+      def poisson(shape: nil, mean: 1.0, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :int32)
         rng.poisson(x, mean: mean)
         x
       end
@@ -222,13 +430,16 @@ module Numo
       #   rng = Numo::Random::Generator.new
       #   x = rng.weibull(shape: 100, k: 5, scale: 2)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param k [Float] shape parameter.
-      # @param scale [Float] scale parameter.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param k [Float | Numo::DFloat] shape parameter.
+      # @param scale [Float | Numo::DFloat] scale parameter.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :float64 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::DFloat | Numo::SFloat]
-      def weibull(shape:, k:, scale: 1.0, dtype: :float64)
-        x = klass(dtype).new(shape)
+      def weibull(k:, shape: nil, scale: 1.0, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :float64)
         rng.weibull(x, k: k, scale: scale)
         x
       end
@@ -249,16 +460,47 @@ module Numo
       #   #  [0, 1, 0, 1, 1, 0, 1, 1, 2, 1],
       #   #  [2, 1, 1, 1, 1, 2, 2, 1, 1, 2]]
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param weight [Numo::DFloat | Numo::SFloat] (shape: [n]) list of probabilities of each integer being generated.
+      #   # The alias table built from the weights can be reused to skip the setup on every call.
+      #   table = Numo::Random::AliasTable.new(w)
+      #   y = rng.discrete(shape: 10, weight: table)
+      #
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param weight [Numo::DFloat | Numo::SFloat | Numo::Random::AliasTable] (shape: [n]) list of probabilities of
+      #   each integer being generated, or the alias table built from it. Each integer is sampled in constant time
+      #   with the alias method.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :int32 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::IntX | Numo::UIntX]
-      def discrete(shape:, weight:, dtype: :int32)
-        x = klass(dtype).new(shape)
+      def discrete(weight:, shape: nil, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :int32)
         rng.discrete(x, weight: weight)
         x
       end
 
+      # Generates array consists of uniformly distributed random integers in the interval [low, high).
+      #
+      # @example
+      #   require 'numo/random'
+      #
+      #   rng = Numo::Random::Generator.new
+      #   x = rng.integers(shape: 1000, low: 0, high: 10)
+      #
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param low [Integer] lower boundary.
+      # @param high [Integer] upper boundary, which is excluded. The interval must be within the range of dtype.
+      # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :int32 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
+      # @return [Numo::IntX | Numo::UIntX]
+      def integers(low:, high:, shape: nil, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :int32)
+        rng.integers(x, low: low, high: high)
+        x
+      end
+
       # Generates array consists of uniformly distributed random values in the interval [low, high).
       #
       # @example
@@ -267,13 +509,16 @@ module Numo
       #   rng = Numo::Random::Generator.new
       #   x = rng.uniform(shape: 100, low: -1.5, high: 1.5)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param low [Float] lower boundary.
-      # @param high [Float] upper boundary.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param low [Float | Numo::DFloat] lower boundary.
+      # @param high [Float | Numo::DFloat] upper boundary.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :float64 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::DFloat | Numo::SFloat]
-      def uniform(shape:, low: 0.0, high: 1.0, dtype: :float64)
-        x = klass(dtype).new(shape)
+      def uniform(shape: nil, low: 0.0, high: 1.0, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :float64)
         rng.uniform(x, low: low, high: high)
         x
       end
@@ -286,13 +531,16 @@ module Numo
       #   rng = Numo::Random::Generator.new
       #   x = rng.cauchy(shape: 100, loc: 0.0, scale: 1.0)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param loc [Float] location parameter.
-      # @param scale [Float] scale parameter.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param loc [Float | Numo::DFloat] location parameter.
+      # @param scale [Float | Numo::DFloat] scale parameter.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :float64 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::DFloat | Numo::SFloat]
-      def cauchy(shape:, loc: 0.0, scale: 1.0, dtype: :float64)
-        x = klass(dtype).new(shape)
+      def cauchy(shape: nil, loc: 0.0, scale: 1.0, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :float64)
         rng.cauchy(x, loc: loc, scale: scale)
         x
       end
@@ -305,12 +553,15 @@ module Numo
       #   rng = Numo::Random::Generator.new
       #   x = rng.chisquare(shape: 100, df: 2.0)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param df [Float] degrees of freedom, must be > 0.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param df [Float | Numo::DFloat] degrees of freedom, must be > 0.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :float64 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::DFloat | Numo::SFloat]
-      def chisquare(shape:, df:, dtype: :float64)
-        x = klass(dtype).new(shape)
+      def chisquare(df:, shape: nil, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :float64)
         rng.chisquare(x, df: df)
         x
       end
@@ -323,13 +574,16 @@ module Numo
       #   rng = Numo::Random::Generator.new
       #   x = rng.f(shape: 100, dfnum: 2.0, dfden: 4.0)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param dfnum [Float] degrees of freedom in numerator, must be > 0.
-      # @param dfden [Float] degrees of freedom in denominator, must be > 0.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param dfnum [Float | Numo::DFloat] degrees of freedom in numerator, must be > 0.
+      # @param dfden [Float | Numo::DFloat] degrees of freedom in denominator, must be > 0.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :float64 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::DFloat | Numo::SFloat]
-      def f(shape:, dfnum:, dfden:, dtype: :float64)
-        x = klass(dtype).new(shape)
+      def f(dfnum:, dfden:, shape: nil, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :float64)
         rng.f(x, dfnum: dfnum, dfden: dfden)
         x
       end
@@ -342,13 +596,16 @@ module Numo
       #   rng = Numo::Random::Generator.new
       #   x = rng.normal(shape: 100, loc: 0.0, scale: 1.0)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param loc [Float] location parameter.
-      # @param scale [Float] scale parameter.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param loc [Float | Numo::DFloat] location parameter.
+      # @param scale [Float | Numo::DFloat] scale parameter.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :float64 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::DFloat | Numo::SFloat]
-      def normal(shape:, loc: 0.0, scale: 1.0, dtype: :float64)
-        x = klass(dtype).new(shape)
+      def normal(shape: nil, loc: 0.0, scale: 1.0, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :float64)
         rng.normal(x, loc: loc, scale: scale)
         x
       end
@@ -361,13 +618,16 @@ module Numo
       #   rng = Numo::Random::Generator.new
       #   x = rng.lognormal(shape: 100, mean: 0.0, sigma: 1.0)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param mean [Float] mean of normal distribution.
-      # @param sigma [Float] standard deviation of normal distribution.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param mean [Float | Numo::DFloat] mean of normal distribution.
+      # @param sigma [Float | Numo::DFloat] standard deviation of normal distribution.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :float64 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::DFloat | Numo::SFloat]
-      def lognormal(shape:, mean: 0.0, sigma: 1.0, dtype: :float64)
-        x = klass(dtype).new(shape)
+      def lognormal(shape: nil, mean: 0.0, sigma: 1.0, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :float64)
         rng.lognormal(x, mean: mean, sigma: sigma)
         x
       end
@@ -380,18 +640,36 @@ module Numo
       #   rng = Numo::Random::Generator.new
       #   x = rng.standard_t(shape: 100, df: 8.0)
       #
-      # @param shape [Integer | Array<Integer>] size of random array.
-      # @param df [Float] degrees of freedom, must be > 0.
+      # @param shape [Integer | Array<Integer>] size of random array. If nil, the shape of out is used.
+      # @param df [Float | Numo::DFloat] degrees of freedom, must be > 0.
       # @param dtype [Symbol] data type of random array.
+      #   If nil, the type of out is used, or :float64 if out is not given.
+      # @param out [Numo::NArray] array to be filled with the random values instead of a new array.
+      #   Its type and shape must be the same as the ones given by dtype and shape if they are given.
       # @return [Numo::DFloat | Numo::SFloat]
-      def standard_t(shape:, df:, dtype: :float64)
-        x = klass(dtype).new(shape)
+      def standard_t(df:, shape: nil, dtype: nil, out: nil)
+        x = output_array(shape, dtype, out, :float64)
         rng.standard_t(x, df: df)
         x
       end
 
       private
 
+      # Returns the given array after checking its type and shape against the given dtype and shape,
+      # or a new array of them if it is not given. The default dtype is used only for the new array.
+      def output_array(shape, dtype, out, default_dtype)
+        if out.nil?
+          raise ArgumentError, 'shape must be given if out is not given' if shape.nil?
+
+          return klass(dtype || default_dtype).new(shape)
+        end
+        raise TypeError, 'out must be Numo::NArray' unless out.is_a?(Numo::NArray)
+        raise TypeError, "out must be #{klass(dtype)}" unless dtype.nil? || out.is_a?(klass(dtype))
+        raise ArgumentError, "shape of out must be #{Array(shape)}" unless shape.nil? || out.shape == Array(shape)
+
+        out
+      end
+
       attr_reader :rng
 
       def klass(dtype) # rubocop:disable Metrics/CyclomaticComplexity, Metrics/MethodLength
@@ -416,6 +694,8 @@ module Numo
           Numo::SFloat
         when :float64, :dfloat
           Numo::DFloat
+        when :bit
+          Numo::Bit
         else
           raise ArgumentError, "wrong dtype is given: #{dtype}"
         end
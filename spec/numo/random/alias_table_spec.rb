@@ -0,0 +1,85 @@
+# frozen_string_literal: true
+
+RSpec.describe Numo::Random::AliasTable do
+  subject(:table) { described_class.new(w) }
+
+  let(:w) { Numo::DFloat[0.1, 0.6, 0.0, 0.3] }
+
+  describe '#initialize' do
+    it 'builds the table from the given weight' do
+      expect(table.size).to eq(4)
+    end
+
+    it 'builds the table from single precision weight' do
+      expect(described_class.new(Numo::SFloat[1, 2, 3]).size).to eq(3)
+    end
+
+    it 'raises TypeError when integer typed array is given' do
+      expect do
+        described_class.new(Numo::Int32[1, 6, 3])
+      end.to raise_error(TypeError, 'weight must be Numo::DFloat or Numo::SFloat')
+    end
+
+    it 'raises ArgumentError when multi-dimensional array is given' do
+      expect do
+        described_class.new(Numo::DFloat[[0.1, 0.9], [0.5, 0.5]])
+      end.to raise_error(ArgumentError, 'weight must be 1-dimensional array')
+    end
+
+    it 'raises ArgumentError when empty array is given' do
+      expect { described_class.new(Numo::DFloat[]) }.to raise_error(ArgumentError, 'length of weight must be > 0')
+    end
+
+    it 'raises ArgumentError when negative weight is given' do
+      expect do
+        described_class.new(Numo::DFloat[0.5, -0.1, 0.6])
+      end.to raise_error(ArgumentError, 'weight must be non-negative finite values')
+    end
+
+    it 'raises ArgumentError when all weights are zero' do
+      expect do
+        described_class.new(Numo::DFloat[0, 0])
+      end.to raise_error(ArgumentError, 'sum of weight must be a positive finite value')
+    end
+  end
+
+  describe '#dup' do
+    it 'copies the table' do
+      expect(table.dup.size).to eq(4)
+    end
+  end
+
+  describe 'sampling' do
+    let(:rng) { Numo::Random::PCG64.new(seed: 42) }
+    let(:x) { Numo::Int32.new(200, 500).tap { |x| rng.discrete(x, weight: table) } }
+
+    it 'obtains random integers in proportion to the weight', :aggregate_failures do
+      expect(x.eq(0).count.fdiv(x.size)).to be_within(1e-2).of(0.1)
+      expect(x.eq(1).count.fdiv(x.size)).to be_within(1e-2).of(0.6)
+      expect(x.eq(2).count).to eq(0)
+      expect(x.eq(3).count.fdiv(x.size)).to be_within(1e-2).of(0.3)
+    end
+
+    it 'obtains the same values as sampling with the weight' do
+      y = Numo::Int32.new(200, 500)
+      Numo::Random::PCG64.new(seed: 42).discrete(y, weight: w)
+      expect(x).to eq(y)
+    end
+
+    it 'obtains the same values as the table built from a view of the weight', :aggregate_failures do
+      w_view = Numo::DFloat[0.5, 0.1, 0.6, 0.0, 0.3][1..-1]
+      y = Numo::Int32.new(200, 500)
+      Numo::Random::PCG64.new(seed: 42).discrete(y, weight: described_class.new(w_view))
+      z = Numo::Int32.new(200, 500)
+      Numo::Random::PCG64.new(seed: 42).discrete(z, weight: w_view)
+      expect(y).to eq(x)
+      expect(z).to eq(x)
+    end
+
+    it 'raises ArgumentError when the table is not initialized' do
+      expect do
+        rng.discrete(Numo::Int32.new(2), weight: described_class.allocate)
+      end.to raise_error(ArgumentError, 'alias table is not initialized')
+    end
+  end
+end
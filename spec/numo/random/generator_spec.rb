@@ -42,6 +42,77 @@ RSpec.describe Numo::Random::Generator do
       end
     end
 
+    context "when algorithm args is 'pcg64_fast'" do
+      let(:algorithm) { 'pcg64_fast' }
+
+      it 'uses PCG64Fast class for random number generator', :aggregate_failures do
+        expect(rng.algorithm).to eq('pcg64_fast')
+        expect(rng.instance_variable_get(:@rng)).to be_a(Numo::Random::PCG64Fast)
+      end
+    end
+
+    context "when algorithm args is 'pcg64_k1024'" do
+      let(:algorithm) { 'pcg64_k1024' }
+
+      it 'uses PCG64K1024 class for random number generator', :aggregate_failures do
+        expect(rng.algorithm).to eq('pcg64_k1024')
+        expect(rng.instance_variable_get(:@rng)).to be_a(Numo::Random::PCG64K1024)
+      end
+    end
+
+    context "when algorithm args is 'pcg32x8'" do
+      let(:algorithm) { 'pcg32x8' }
+
+      it 'uses PCG32x8 class for random number generator', :aggregate_failures do
+        expect(rng.algorithm).to eq('pcg32x8')
+        expect(rng.instance_variable_get(:@rng)).to be_a(Numo::Random::PCG32x8)
+      end
+    end
+
+    context "when algorithm args is 'xoshiro256'" do
+      let(:algorithm) { 'xoshiro256' }
+
+      it 'uses Xoshiro256 class for random number generator', :aggregate_failures do
+        expect(rng.algorithm).to eq('xoshiro256')
+        expect(rng.instance_variable_get(:@rng)).to be_a(Numo::Random::Xoshiro256)
+      end
+    end
+
+    context "when algorithm args is 'philox4x32'" do
+      let(:algorithm) { 'philox4x32' }
+
+      it 'uses Philox4x32 class for random number generator', :aggregate_failures do
+        expect(rng.algorithm).to eq('philox4x32')
+        expect(rng.instance_variable_get(:@rng)).to be_a(Numo::Random::Philox4x32)
+      end
+    end
+
+    context "when algorithm args is 'philox4x64'" do
+      let(:algorithm) { 'philox4x64' }
+
+      it 'uses Philox4x64 class for random number generator', :aggregate_failures do
+        expect(rng.algorithm).to eq('philox4x64')
+        expect(rng.instance_variable_get(:@rng)).to be_a(Numo::Random::Philox4x64)
+      end
+    end
+
+    context 'when stream args is given' do
+      let(:other) { described_class.new(seed: 42, stream: 7) }
+
+      it 'uses the given stream', :aggregate_failures do
+        expect(other.instance_variable_get(:@rng).stream).to eq(7)
+        expect(other.random).not_to eq(rng.random)
+      end
+    end
+
+    context "when stream args is given with 'mt64' algorithm" do
+      it 'raises ArgumentError' do
+        expect do
+          described_class.new(seed: 42, algorithm: 'mt64', stream: 7)
+        end.to raise_error(ArgumentError, "Numo::Random::Generator does not support stream with 'mt64' algorithm")
+      end
+    end
+
     context 'when wrong algorithm args given' do
       let(:algorithm) { 'none' }
 
@@ -49,6 +120,41 @@ RSpec.describe Numo::Random::Generator do
         expect { rng }.to raise_error(ArgumentError, "Numo::Random::Generator does not support 'none' algorithm")
       end
     end
+
+    context 'when the current kernel version is given' do
+      it 'creates the generator' do
+        expect(described_class.new(seed: 42, kernel_version: Numo::Random::KERNEL_VERSION)).to be_a(described_class)
+      end
+    end
+
+    context 'when other kernel version is given' do
+      it 'raises ArgumentError' do
+        expect do
+          described_class.new(seed: 42, kernel_version: Numo::Random::KERNEL_VERSION + 1)
+        end.to raise_error(ArgumentError, /does not support kernel version #{Numo::Random::KERNEL_VERSION + 1}/)
+      end
+    end
+  end
+
+  describe 'kernel version 1' do
+    # These values must not change without incrementing Numo::Random::KERNEL_VERSION.
+    it 'generates the same values from the same seed', :aggregate_failures do
+      expect(described_class.new(seed: 42).uniform(shape: 4).to_a).to eq(
+        [0.15802686859384152, 0.7336664610327854, 0.7140943613027889, 0.7475508149475342]
+      )
+      expect(described_class.new(seed: 42).normal(shape: 4).to_a).to eq(
+        [0.33819471580792404, -0.9848739097754143, 1.0943229262666023, 1.3211329534705665]
+      )
+      expect(described_class.new(seed: 42).poisson(shape: 8, mean: 4.5).to_a).to eq([6, 3, 3, 2, 5, 5, 3, 2])
+      expect(described_class.new(seed: 42).binomial(shape: 8, n: 100, p: 0.4).to_a).to eq(
+        [37, 36, 38, 36, 46, 43, 36, 38]
+      )
+      expect(described_class.new(seed: 42).geometric(shape: 8, p: 0.2).to_a).to eq([0, 7, 1, 1, 3, 5, 0, 4])
+      expect(described_class.new(seed: 42).bernoulli(shape: 8, p: 0.3).to_a).to eq([0, 0, 0, 0, 0, 1, 0, 1])
+      expect(described_class.new(seed: 42).discrete(shape: 8, weight: Numo::DFloat[0.1, 0.6, 0.3]).to_a).to eq(
+        [1, 2, 2, 2, 1, 1, 1, 1]
+      )
+    end
   end
 
   describe '#seed= and #seed' do
@@ -59,12 +165,117 @@ RSpec.describe Numo::Random::Generator do
     end
   end
 
+  describe '#spawn' do
+    let(:children) { rng.spawn(2) }
+
+    it 'creates independent generators with the same algorithm', :aggregate_failures do
+      expect(children).to all(be_a(described_class))
+      expect(children.map(&:algorithm)).to all(eq(algorithm))
+      expect(children.map { |child| child.seed.spawn_key }).to eq([[0], [1]])
+      expect(children[0].random).not_to eq(children[1].random)
+    end
+
+    it 'creates different generators on every call' do
+      children
+      expect(rng.spawn(1)[0].seed.spawn_key).to eq([2])
+    end
+
+    it 'creates generators from a negative seed', :aggregate_failures do
+      negative = described_class.new(seed: -1, algorithm: algorithm).spawn(2)
+      expect(negative.map { |child| child.seed.entropy }).to all(eq(2**64 - 1))
+      expect(negative[0].random).not_to eq(negative[1].random)
+    end
+  end
+
+  describe '#threads= and #threads' do
+    it 'sets and gets the number of threads', :aggregate_failures do
+      expect(rng.threads).to eq(1)
+      rng.threads = 4
+      expect(rng.threads).to eq(4)
+    end
+  end
+
+  describe '#advance' do
+    let(:other) { described_class.new(seed: 42, algorithm: algorithm) }
+
+    it 'advances the state of random number generator' do
+      other.random
+      rng.advance(1)
+      expect(rng.random).to eq(other.random)
+    end
+
+    context "when algorithm args is 'mt64'" do
+      let(:algorithm) { 'mt64' }
+
+      it 'raises NotImplementedError' do
+        expect { rng.advance(1) }.to raise_error(NotImplementedError)
+      end
+    end
+  end
+
   describe '#random' do
     it 'gets random number' do
       expect(rng.random).not_to be_nil
     end
   end
 
+  describe '#shuffle' do
+    let(:x) { Numo::DFloat.cast(Array(0...30)).tap { |x| x.reshape!(10, 3) } }
+
+    it 'shuffles the rows in-place and returns the given array', :aggregate_failures do
+      expect(rng.shuffle(x)).to be(x)
+      rows = x.to_a.flatten.each_slice(3).to_a
+      expect(rows.sort).to eq(Array(0...30).each_slice(3).to_a)
+      expect(rows).not_to eq(Array(0...30).each_slice(3).to_a)
+    end
+  end
+
+  describe '#permutation' do
+    let(:x) { rng.permutation(1000) }
+
+    it 'obtains a random permutation', :aggregate_failures do
+      expect(x).to be_a(Numo::Int64)
+      expect(x.to_a.sort).to eq(Array(0...1000))
+      expect(x.to_a).not_to eq(Array(0...1000))
+    end
+
+    context 'when dtype is given' do
+      it 'obtains a random permutation with the given type' do
+        expect(rng.permutation(10, dtype: :uint8)).to be_a(Numo::UInt8)
+      end
+    end
+  end
+
+  describe '#choice' do
+    context 'when the number of candidates is given' do
+      let(:x) { rng.choice(1_000_000, size: [5, 2], replace: false) }
+
+      it 'obtains distinct indices of the candidates', :aggregate_failures do
+        expect(x).to be_a(Numo::Int64)
+        expect(x.shape).to eq([5, 2])
+        expect(x.to_a.flatten.uniq.size).to eq(10)
+        expect(x.to_a.flatten).to all(be_between(0, 999_999))
+      end
+    end
+
+    context 'when array of candidates and weight are given' do
+      let(:a) { Numo::DFloat[1.5, 2.5, 3.5] }
+      let(:x) { rng.choice(a, size: 1000, p: Numo::DFloat[0.2, 0.8, 0]) }
+
+      it 'obtains elements of the array drawn with the probabilities', :aggregate_failures do
+        expect(x).to be_a(Numo::DFloat)
+        expect(x.to_a.uniq.sort).to eq([1.5, 2.5])
+        expect(x.eq(2.5).count.fdiv(x.size)).to be_within(5e-2).of(0.8)
+      end
+    end
+
+    context 'when dtype is given' do
+      it 'obtains indices with the given type' do
+        expect(rng.choice(10, size: 3, dtype: :uint8)).to be_a(Numo::UInt8)
+      end
+    end
+  end
+
   describe '#bernoulli' do
     %i[int8 int16 int32 int64 uint8 uint16 uint32 uint64].each do |dtype|
       context "when array type is #{dtype}" do
@@ -77,6 +288,15 @@ RSpec.describe Numo::Random::Generator do
         end
       end
     end
+
+    context 'when array type is bit' do
+      let(:x) { rng.bernoulli(shape: [100, 100], p: 0.4, dtype: :bit) }
+
+      it 'obtained random bits from the Bernoulli distribution', :aggregate_failures do
+        expect(x).to be_a(Numo::Bit)
+        expect(x.count_true.fdiv(10_000)).to be_within(1e-2).of(0.4)
+      end
+    end
   end
 
   describe '#binomial' do
@@ -89,6 +309,17 @@ RSpec.describe Numo::Random::Generator do
         end
       end
     end
+
+    [0.3, 0.7].each do |p|
+      context "when n * p is large and p is #{p}" do
+        let(:x) { rng.binomial(shape: [100_000], n: 5000, p: p) }
+
+        it 'obtained randomized integer number from a binomial distribution', :aggregate_failures do
+          expect(x.mean).to be_within(0.5).of(5000 * p)
+          expect(x.var).to be_within(20).of(5000 * p * (1 - p))
+        end
+      end
+    end
   end
 
   describe '#negative_binomial' do
@@ -109,7 +340,7 @@ RSpec.describe Numo::Random::Generator do
         let(:x) { rng.geometric(shape: [10_000], p: 0.4, dtype: dtype) }
 
         it 'obtained randomized integer number from a geometric distribution', :aggregate_failures do
-          expect(x.eq(0).count.fdiv(10_000)).to be_within(1e-2).of(0.4)
+          expect(x.eq(0).count.fdiv(10_000)).to be_within(2.5e-2).of(0.4)
         end
       end
     end
@@ -143,8 +374,8 @@ RSpec.describe Numo::Random::Generator do
 
       it 'obtains random numbers form a gamma distribution', :aggregate_failures do
         expect(x).to be_a(Numo::DFloat)
-        expect(x.mean).to be_within(1e-2).of(1)
-        expect(x.var).to be_within(1e-2).of(2)
+        expect(x.mean).to be_within(2.5e-2).of(1)
+        expect(x.var).to be_within(1.2e-1).of(2)
       end
     end
 
@@ -153,8 +384,8 @@ RSpec.describe Numo::Random::Generator do
 
       it 'obtains random numbers form a gamma distribution', :aggregate_failures do
         expect(x).to be_a(Numo::SFloat)
-        expect(x.mean).to be_within(1e-2).of(1)
-        expect(x.var).to be_within(1e-2).of(2)
+        expect(x.mean).to be_within(2.5e-2).of(1)
+        expect(x.var).to be_within(1.2e-1).of(2)
       end
     end
   end
@@ -191,6 +422,15 @@ RSpec.describe Numo::Random::Generator do
         end
       end
     end
+
+    context 'when mean is large' do
+      let(:x) { rng.poisson(shape: [100_000], mean: 1000) }
+
+      it 'obtained randomized integer number from the Poisson distribution', :aggregate_failures do
+        expect(x.mean).to be_within(0.5).of(1000)
+        expect(x.var).to be_within(20).of(1000)
+      end
+    end
   end
 
   describe '#weibull' do
@@ -229,6 +469,39 @@ RSpec.describe Numo::Random::Generator do
         end
       end
     end
+
+    context 'when given alias table to weight' do
+      let(:table) { Numo::Random::AliasTable.new(w) }
+      let(:x) { rng.discrete(shape: [100, 100], weight: table) }
+
+      it 'obtained randomized integer number from a discrete distribution', :aggregate_failures do
+        expect(x.eq(0).count.fdiv(x.size)).to be_within(1e-2).of(w[0])
+        expect(x.eq(1).count.fdiv(x.size)).to be_within(1e-2).of(w[1])
+        expect(x.eq(2).count.fdiv(x.size)).to be_within(1e-2).of(w[2])
+      end
+    end
+  end
+
+  describe '#integers' do
+    %i[int8 int16 int32 int64 uint8 uint16 uint32 uint64].each do |dtype|
+      context "when array type is #{dtype}" do
+        let(:x) { rng.integers(shape: [100, 100], low: 2, high: 7, dtype: dtype) }
+
+        it 'obtained random integers drawn uniformly from the interval', :aggregate_failures do
+          expect(x.min).to eq(2)
+          expect(x.max).to eq(6)
+          (2..6).each { |v| expect(x.eq(v).count.fdiv(x.size)).to be_within(2e-2).of(0.2) }
+        end
+      end
+    end
+
+    context 'when the interval covers the whole range of array type' do
+      let(:x) { rng.integers(shape: [10_000], low: 0, high: 2**64, dtype: :uint64) }
+
+      it 'obtained random integers over the whole range' do
+        expect((x / 2**62).bincount.to_a.map { |c| c.fdiv(x.size) }).to all(be_within(2e-2).of(0.25))
+      end
+    end
   end
 
   describe '#uniform' do
@@ -367,8 +640,8 @@ RSpec.describe Numo::Random::Generator do
 
       it 'obtains random numbers form a lognormal distribution', :aggregate_failures do
         expect(x).to be_a(Numo::DFloat)
-        expect(x.mean).to be_within(1e-2).of(Math.exp(0.5))
-        expect(x.var).to be_within(1e-1).of(Math.exp(2) - Math.exp(1))
+        expect(x.mean).to be_within(2e-2).of(Math.exp(0.5))
+        expect(x.var).to be_within(5e-1).of(Math.exp(2) - Math.exp(1))
       end
     end
 
@@ -377,8 +650,8 @@ RSpec.describe Numo::Random::Generator do
 
       it 'obtains random numbers form a lognormal distribution', :aggregate_failures do
         expect(x).to be_a(Numo::SFloat)
-        expect(x.mean).to be_within(1e-2).of(Math.exp(0.5))
-        expect(x.var).to be_within(1e-1).of(Math.exp(2) - Math.exp(1))
+        expect(x.mean).to be_within(2e-2).of(Math.exp(0.5))
+        expect(x.var).to be_within(5e-1).of(Math.exp(2) - Math.exp(1))
       end
     end
 
@@ -386,8 +659,8 @@ RSpec.describe Numo::Random::Generator do
       let(:x) { rng.lognormal(shape: [500, 800], mean: 0.5, sigma: 1) }
 
       it 'obtains random numbers form a lognormal distribution along with given parameters', :aggregate_failures do
-        expect(x.mean).to be_within(1e-2).of(Math.exp(1))
-        expect(x.var).to be_within(1e-1).of(Math.exp(3) - Math.exp(2))
+        expect(x.mean).to be_within(3e-2).of(Math.exp(1))
+        expect(x.var).to be_within(1.1).of(Math.exp(3) - Math.exp(2))
       end
     end
   end
@@ -413,4 +686,173 @@ RSpec.describe Numo::Random::Generator do
       end
     end
   end
+
+  describe 'parameters given as NArray' do
+    context 'when loc of normal distribution is given as NArray' do
+      let(:loc) { Numo::DFloat.cast(Array.new(10_000) { |i| i * 0.5 }) }
+      let(:x) { rng.normal(shape: [10_000], loc: loc, scale: 0.01) }
+
+      it 'obtains random numbers from normal distributions with the location of each element' do
+        expect((x - loc).abs.max).to be_within(0.1).of(0)
+      end
+    end
+
+    context 'when parameter array is broadcast' do
+      let(:x) { rng.normal(shape: [500, 200], loc: Numo::DFloat[10], scale: 2, dtype: :float32) }
+
+      it 'obtains random numbers form a normal distribution along with given parameters', :aggregate_failures do
+        expect(x).to be_a(Numo::SFloat)
+        expect(x.mean).to be_within(1e-2).of(10)
+        expect(x.stddev).to be_within(1e-2).of(2)
+      end
+    end
+
+    context 'when mean of Poisson distribution is given as NArray' do
+      let(:x) { rng.poisson(shape: [100_000], mean: Numo::DFloat.cast([1, 10] * 50_000)) }
+
+      it 'obtains random numbers from the mixture of Poisson distributions', :aggregate_failures do
+        expect(x.mean).to be_within(5e-2).of(5.5)
+        expect(x.var).to be_within(0.5).of(25.75)
+      end
+    end
+
+    context 'when p of Bernoulli distribution is given as NArray' do
+      let(:x) { rng.bernoulli(shape: [1000], p: Numo::DFloat.cast([0, 1] * 500), dtype: :bit) }
+
+      it 'obtains random bits with the probability of each element' do
+        expect(x.to_a).to eq([0, 1] * 500)
+      end
+    end
+
+    context 'when exponential distribution is given scale as NArray' do
+      let(:x) { rng.exponential(shape: [100_000], scale: Numo::DFloat.cast([2.0] * 100_000)) }
+
+      it 'obtains random numbers from an exponential distribution with given scale' do
+        expect(x.mean).to be_within(5e-2).of(2)
+      end
+    end
+
+    context 'when invalid value is included in parameter array' do
+      it 'raises ArgumentError', :aggregate_failures do
+        expect { rng.normal(shape: [2], scale: Numo::DFloat[1, -1]) }.to raise_error(
+          ArgumentError, 'scale must be a non-negative value'
+        )
+        expect { rng.uniform(shape: [2], low: Numo::DFloat[0, 2], high: 1) }.to raise_error(
+          ArgumentError, 'high - low must be > 0'
+        )
+        expect { rng.binomial(shape: [2], n: 10, p: Numo::DFloat[0.5, 1.5]) }.to raise_error(
+          ArgumentError, 'p must be >= 0 and <= 1'
+        )
+      end
+
+      it 'raises ArgumentError when NaN or a too large value is included', :aggregate_failures do
+        expect { rng.binomial(shape: [2], n: Numo::DFloat[10, Float::NAN], p: 0.5) }.to raise_error(
+          ArgumentError, 'n must be a non-negative value'
+        )
+        expect { rng.binomial(shape: [2], n: Numo::DFloat[10, 1e30], p: 0.5) }.to raise_error(
+          ArgumentError, 'n must be < 2**63'
+        )
+        expect { rng.negative_binomial(shape: [2], n: Numo::DFloat[10, Float::INFINITY], p: 0.5) }.to raise_error(
+          ArgumentError, 'n must be < 2**63'
+        )
+        expect { rng.binomial(shape: [2], n: 10, p: Numo::DFloat[0.5, Float::NAN]) }.to raise_error(
+          ArgumentError, 'p must be >= 0 and <= 1'
+        )
+        expect { rng.geometric(shape: [2], p: Numo::DFloat[0.5, Float::NAN]) }.to raise_error(
+          ArgumentError, 'p must be > 0 and < 1'
+        )
+      end
+    end
+
+    context 'when shape of parameter array does not match' do
+      it 'raises ArgumentError' do
+        expect { rng.normal(shape: [2], loc: Numo::DFloat[1, 2, 3]) }.to raise_error(
+          ArgumentError, 'shape of loc does not match the shape of the array'
+        )
+      end
+    end
+  end
+
+  describe 'out keyword' do
+    context 'when array is given' do
+      let(:out) { Numo::DFloat.new(500, 600) }
+
+      it 'fills the given array and returns it', :aggregate_failures do
+        expect(rng.normal(shape: [500, 600], loc: 2, out: out)).to be(out)
+        expect(out.mean).to be_within(1e-2).of(2)
+        expect(out.stddev).to be_within(1e-2).of(1)
+      end
+    end
+
+    context 'when view of array is given' do
+      let(:base) { Numo::DFloat.cast([0.0] * 10) }
+
+      it 'fills only the elements of the view', :aggregate_failures do
+        rng.uniform(shape: 5, low: 1, high: 2, out: base[2..6])
+        expect(base.to_a.values_at(0, 1, 7, 8, 9)).to all(eq(0))
+        expect(base.to_a[2..6]).to all(be_between(1, 2))
+      end
+
+      it 'writes the permutation only to the elements of the view', :aggregate_failures do
+        ints = Numo::Int32.new(10).fill(-1)
+        rng.permutation(out: ints[2..6])
+        expect(ints.to_a.values_at(0, 1, 7, 8, 9)).to all(eq(-1))
+        expect(ints.to_a[2..6].sort).to eq((0...5).to_a)
+      end
+
+      it 'writes the sample without replacement only to the elements of the view', :aggregate_failures do
+        ints = Numo::Int64.new(10).fill(-1)
+        rng.choice(5, replace: false, out: ints[2..6])
+        expect(ints.to_a.values_at(0, 1, 7, 8, 9)).to all(eq(-1))
+        expect(ints.to_a[2..6].sort).to eq((0...5).to_a)
+      end
+    end
+
+    context 'when integer and bit arrays are given' do
+      let(:ints) { Numo::UInt16.new(1000) }
+      let(:bits) { Numo::Bit.new(1000) }
+
+      it 'fills the given arrays', :aggregate_failures do
+        rng.poisson(shape: 1000, mean: 5.0, dtype: :uint16, out: ints)
+        rng.bernoulli(shape: 1000, p: 0.3, dtype: :bit, out: bits)
+        expect(ints.mean).to be_within(0.3).of(5.0)
+        expect(bits.count_true.fdiv(1000)).to be_within(5e-2).of(0.3)
+      end
+    end
+
+    context 'when only array is given' do
+      let(:floats) { Numo::SFloat.new(500, 600) }
+      let(:ints) { Numo::UInt8.new(1000) }
+
+      it 'takes the type and shape from the given array', :aggregate_failures do
+        expect(rng.normal(loc: 2, out: floats)).to be(floats)
+        expect(rng.integers(low: 0, high: 10, out: ints)).to be(ints)
+        expect(rng.permutation(out: Numo::Int32.new(10)).sort.to_a).to eq((0...10).to_a)
+        expect(floats.mean).to be_within(1e-2).of(2)
+        expect(ints.to_a).to all(be_between(0, 9))
+      end
+    end
+
+    context 'when neither shape nor array is given' do
+      it 'raises ArgumentError' do
+        expect { rng.uniform }.to raise_error(ArgumentError, 'shape must be given if out is not given')
+      end
+    end
+
+    context 'when type of array does not match dtype' do
+      it 'raises TypeError' do
+        expect do
+          rng.uniform(shape: 5, dtype: :float32, out: Numo::DFloat.new(5))
+        end.to raise_error(TypeError, 'out must be Numo::SFloat')
+      end
+    end
+
+    context 'when shape of array does not match shape' do
+      it 'raises ArgumentError' do
+        expect do
+          rng.uniform(shape: [2, 3], out: Numo::DFloat.new(6))
+        end.to raise_error(ArgumentError, 'shape of out must be [2, 3]')
+      end
+    end
+  end
 end
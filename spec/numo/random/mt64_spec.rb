@@ -9,6 +9,63 @@ RSpec.describe Numo::Random::MT64 do
       rng.seed = 100
       expect(rng.seed).to eq(100)
     end
+
+    it 'initializes the state with SeedSequence', :aggregate_failures do
+      seq = Numo::Random::SeedSequence.new(entropy: 42)
+      rng.seed = seq
+      expect(rng.seed).to eq(seq)
+      expect(rng.random).to eq(described_class.new(seed: Numo::Random::SeedSequence.new(entropy: 42)).random)
+    end
+
+    it 'uses SeedSequence when seed is not given' do
+      expect(described_class.new.seed).to be_a(Numo::Random::SeedSequence)
+    end
+  end
+
+  describe '#dup' do
+    it 'copies the state of random number generator' do
+      rng.random
+      expect(rng.dup.random).to eq(rng.random)
+    end
+  end
+
+  describe '#jump' do
+    it 'advances the state in the same way as jumped' do
+      other = described_class.new(seed: 42)
+      rng.jump(2)
+      expect(rng.random).to eq(other.jumped.jumped.random)
+    end
+
+    it 'raises ArgumentError when negative value is given' do
+      expect { rng.jump(-1) }.to raise_error(ArgumentError, 'n must be a non-negative value')
+    end
+  end
+
+  describe '#jumped' do
+    let(:jumped) { rng.jumped }
+
+    it 'returns a new random number generator with the jumped state', :aggregate_failures do
+      expect(jumped).to be_a(described_class)
+      expect(jumped.seed).to eq(42)
+      expect(jumped.random).not_to eq(rng.random)
+    end
+
+    it 'does not change the state of the original random number generator' do
+      jumped
+      expect(rng.random).to eq(described_class.new(seed: 42).random)
+    end
+  end
+
+  describe '#threads= and #threads' do
+    it 'sets and gets the number of threads', :aggregate_failures do
+      expect(rng.threads).to eq(1)
+      rng.threads = 4
+      expect(rng.threads).to eq(4)
+    end
+
+    it 'raises ArgumentError when zero is given' do
+      expect { rng.threads = 0 }.to raise_error(ArgumentError, 'threads must be > 0')
+    end
   end
 
   describe '#random' do
@@ -17,6 +74,10 @@ RSpec.describe Numo::Random::MT64 do
     end
   end
 
+  describe '#bernoulli' do
+    it_behaves_like 'Bernoulli sampler'
+  end
+
   describe '#binomial' do
     [Numo::Int8, Numo::Int16, Numo::Int32, Numo::Int64,
      Numo::UInt8, Numo::UInt16, Numo::UInt32, Numo::UInt64].each do |klass|
@@ -135,7 +196,7 @@ RSpec.describe Numo::Random::MT64 do
 
         it 'obtained randomized integer number from a geometric distribution', :aggregate_failures do
           expect(x).to be_a(klass)
-          expect(x.eq(0).count.fdiv(10_000)).to be_within(1e-2).of(0.4)
+          expect(x.eq(0).count.fdiv(10_000)).to be_within(2.5e-2).of(0.4)
         end
       end
     end
@@ -192,8 +253,8 @@ RSpec.describe Numo::Random::MT64 do
 
         it 'obtains random numbers from an exponential distribution', :aggregate_failures do
           expect(x).to be_a(klass)
-          expect(x.mean).to be_within(1e-2).of(0.5)
-          expect(x.var).to be_within(1e-2).of(0.25)
+          expect(x.mean).to be_within(3e-2).of(0.5)
+          expect(x.var).to be_within(4e-2).of(0.25)
         end
       end
     end
@@ -474,6 +535,10 @@ RSpec.describe Numo::Random::MT64 do
     end
   end
 
+  describe '#integers' do
+    it_behaves_like 'integers sampler'
+  end
+
   describe '#uniform' do
     context 'when array type is DFloat' do
       let(:x) { Numo::DFloat.new(500, 600).tap { |x| rng.uniform(x, low: 1, high: 4) } }
@@ -814,4 +879,45 @@ RSpec.describe Numo::Random::MT64 do
       end
     end
   end
+
+  describe 'filling a large array' do
+    let(:n) { 200_000 }
+
+    it 'generates the same values as filling the array in small pieces' do
+      x = Numo::DFloat.new(n).tap { |x| rng.uniform(x) }
+      y = Numo::DFloat.new(n)
+      other = described_class.new(seed: 42)
+      (0...n).step(1000) { |i| other.uniform(y[i...(i + 1000)]) }
+      expect(x).to eq(y)
+    end
+
+    it 'does not break the random number generator when used from multiple threads' do
+      xs = Array.new(2) { Numo::DFloat.new(n) }
+      xs.map { |x| Thread.new { rng.uniform(x) } }.each(&:join)
+      other = described_class.new(seed: 42)
+      ys = Array.new(2) { Numo::DFloat.new(n).tap { |y| other.uniform(y) } }
+      expect(xs).to eq(ys).or eq(ys.reverse)
+    end
+
+    [Numo::SFloat, Numo::DFloat].each do |klass|
+      it "generates the same values with multiple threads when array type is #{klass}" do
+        rng.threads = 4
+        x = klass.new(n).tap { |x| rng.uniform(x, low: -1, high: 2) }
+        y = klass.new(n).tap { |y| described_class.new(seed: 42).uniform(y, low: -1, high: 2) }
+        expect(x).to eq(y)
+      end
+    end
+  end
+
+  describe '#shuffle' do
+    it_behaves_like 'shuffler'
+  end
+
+  describe '#permutation' do
+    it_behaves_like 'permutation sampler'
+  end
+
+  describe '#choice' do
+    it_behaves_like 'choice sampler'
+  end
 end
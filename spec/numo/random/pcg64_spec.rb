@@ -9,6 +9,94 @@ RSpec.describe Numo::Random::PCG64 do
       rng.seed = 100
       expect(rng.seed).to eq(100)
     end
+
+    it 'initializes the state with SeedSequence', :aggregate_failures do
+      seq = Numo::Random::SeedSequence.new(entropy: 42)
+      rng.seed = seq
+      expect(rng.seed).to eq(seq)
+      expect(rng.random).to eq(described_class.new(seed: Numo::Random::SeedSequence.new(entropy: 42)).random)
+    end
+
+    it 'uses SeedSequence when seed is not given' do
+      expect(described_class.new.seed).to be_a(Numo::Random::SeedSequence)
+    end
+  end
+
+  describe '#stream' do
+    let(:other) { described_class.new(seed: 42, stream: 7) }
+
+    it 'produces different sequences with the same seed and different streams', :aggregate_failures do
+      expect(other.stream).to eq(7)
+      expect(other.random).not_to eq(rng.random)
+    end
+
+    it 'keeps the stream when the seed is changed', :aggregate_failures do
+      other.seed = 42
+      expect(other.stream).to eq(7)
+      expect(other.random).to eq(described_class.new(seed: 42, stream: 7).random)
+    end
+
+    it 'raises TypeError when a non-integer value is given' do
+      expect { described_class.new(seed: 42, stream: 1.5) }.to raise_error(TypeError, 'stream must be an Integer')
+    end
+  end
+
+  describe '#dup' do
+    it 'copies the state of random number generator' do
+      rng.random
+      expect(rng.dup.random).to eq(rng.random)
+    end
+  end
+
+  describe '#threads= and #threads' do
+    it 'sets and gets the number of threads', :aggregate_failures do
+      expect(rng.threads).to eq(1)
+      rng.threads = 4
+      expect(rng.threads).to eq(4)
+    end
+
+    it 'raises ArgumentError when zero is given' do
+      expect { rng.threads = 0 }.to raise_error(ArgumentError, 'threads must be > 0')
+    end
+  end
+
+  describe '#advance' do
+    let(:draws) { 1 }
+    let(:other) { described_class.new(seed: 42) }
+
+    it 'skips the given number of steps' do
+      4.times { other.random }
+      rng.advance(4 * draws)
+      expect(rng.random).to eq(other.random)
+    end
+
+    it 'accepts a large delta and moves back with a negative delta' do
+      rng.advance(2**100)
+      rng.advance(-2**100)
+      expect(rng.random).to eq(other.random)
+    end
+
+    it 'raises TypeError when a non-integer value is given' do
+      expect { rng.advance(1.5) }.to raise_error(TypeError, 'delta must be an Integer')
+    end
+  end
+
+  describe '#backstep' do
+    it 'moves the state backward' do
+      x = rng.random
+      rng.backstep(1)
+      expect(rng.random).to eq(x)
+    end
+  end
+
+  describe '#discard' do
+    let(:other) { described_class.new(seed: 42) }
+
+    it 'works in the same way as advance' do
+      rng.discard(10)
+      other.advance(10)
+      expect(rng.random).to eq(other.random)
+    end
   end
 
   describe '#random' do
@@ -17,6 +105,10 @@ RSpec.describe Numo::Random::PCG64 do
     end
   end
 
+  describe '#bernoulli' do
+    it_behaves_like 'Bernoulli sampler'
+  end
+
   describe '#binomial' do
     [Numo::Int8, Numo::Int16, Numo::Int32, Numo::Int64,
      Numo::UInt8, Numo::UInt16, Numo::UInt32, Numo::UInt64].each do |klass|
@@ -135,7 +227,7 @@ RSpec.describe Numo::Random::PCG64 do
 
         it 'obtained randomized integer number from a geometric distribution', :aggregate_failures do
           expect(x).to be_a(klass)
-          expect(x.eq(0).count.fdiv(10_000)).to be_within(1e-2).of(0.4)
+          expect(x.eq(0).count.fdiv(10_000)).to be_within(2.5e-2).of(0.4)
         end
       end
     end
@@ -192,8 +284,8 @@ RSpec.describe Numo::Random::PCG64 do
 
         it 'obtains random numbers from an exponential distribution', :aggregate_failures do
           expect(x).to be_a(klass)
-          expect(x.mean).to be_within(1e-2).of(0.5)
-          expect(x.var).to be_within(1e-2).of(0.25)
+          expect(x.mean).to be_within(4e-2).of(0.5)
+          expect(x.var).to be_within(5e-2).of(0.25)
         end
       end
     end
@@ -230,8 +322,8 @@ RSpec.describe Numo::Random::PCG64 do
 
         it 'obtains random numbers form a gamma distribution', :aggregate_failures do
           expect(x).to be_a(klass)
-          expect(x.mean).to be_within(1e-2).of(4.5)
-          expect(x.var).to be_within(1e-1).of(2.25)
+          expect(x.mean).to be_within(8e-2).of(4.5)
+          expect(x.var).to be_within(2e-1).of(2.25)
         end
       end
     end
@@ -474,6 +566,10 @@ RSpec.describe Numo::Random::PCG64 do
     end
   end
 
+  describe '#integers' do
+    it_behaves_like 'integers sampler'
+  end
+
   describe '#uniform' do
     context 'when array type is DFloat' do
       let(:x) { Numo::DFloat.new(500, 600).tap { |x| rng.uniform(x, low: 1, high: 4) } }
@@ -726,8 +822,8 @@ RSpec.describe Numo::Random::PCG64 do
 
       it 'obtains random numbers form a lognormal distribution', :aggregate_failures do
         expect(x).to be_a(Numo::DFloat)
-        expect(x.mean).to be_within(1e-2).of(Math.exp(0.5))
-        expect(x.var).to be_within(1e-1).of(Math.exp(2) - Math.exp(1))
+        expect(x.mean).to be_within(2e-2).of(Math.exp(0.5))
+        expect(x.var).to be_within(5e-1).of(Math.exp(2) - Math.exp(1))
       end
     end
 
@@ -736,8 +832,8 @@ RSpec.describe Numo::Random::PCG64 do
 
       it 'obtains random numbers form a lognormal distribution', :aggregate_failures do
         expect(x).to be_a(Numo::SFloat)
-        expect(x.mean).to be_within(1e-2).of(Math.exp(0.5))
-        expect(x.var).to be_within(1e-1).of(Math.exp(2) - Math.exp(1))
+        expect(x.mean).to be_within(2e-2).of(Math.exp(0.5))
+        expect(x.var).to be_within(5e-1).of(Math.exp(2) - Math.exp(1))
       end
     end
 
@@ -745,8 +841,8 @@ RSpec.describe Numo::Random::PCG64 do
       let(:x) { Numo::DFloat.new(500, 800).tap { |x| rng.lognormal(x, mean: 0.5, sigma: 1) } }
 
       it 'obtains random numbers form a lognormal distribution along with given parameters', :aggregate_failures do
-        expect(x.mean).to be_within(1e-2).of(Math.exp(1))
-        expect(x.var).to be_within(1e-1).of(Math.exp(3) - Math.exp(2))
+        expect(x.mean).to be_within(3e-2).of(Math.exp(1))
+        expect(x.var).to be_within(1.1).of(Math.exp(3) - Math.exp(2))
       end
     end
 
@@ -814,4 +910,45 @@ RSpec.describe Numo::Random::PCG64 do
       end
     end
   end
+
+  describe 'filling a large array' do
+    let(:n) { 200_000 }
+
+    it 'generates the same values as filling the array in small pieces' do
+      x = Numo::DFloat.new(n).tap { |x| rng.uniform(x) }
+      y = Numo::DFloat.new(n)
+      other = described_class.new(seed: 42)
+      (0...n).step(1000) { |i| other.uniform(y[i...(i + 1000)]) }
+      expect(x).to eq(y)
+    end
+
+    it 'does not break the random number generator when used from multiple threads' do
+      xs = Array.new(2) { Numo::DFloat.new(n) }
+      xs.map { |x| Thread.new { rng.uniform(x) } }.each(&:join)
+      other = described_class.new(seed: 42)
+      ys = Array.new(2) { Numo::DFloat.new(n).tap { |y| other.uniform(y) } }
+      expect(xs).to eq(ys).or eq(ys.reverse)
+    end
+
+    [Numo::SFloat, Numo::DFloat].each do |klass|
+      it "generates the same values with multiple threads when array type is #{klass}" do
+        rng.threads = 4
+        x = klass.new(n).tap { |x| rng.uniform(x, low: -1, high: 2) }
+        y = klass.new(n).tap { |y| described_class.new(seed: 42).uniform(y, low: -1, high: 2) }
+        expect(x).to eq(y)
+      end
+    end
+  end
+
+  describe '#shuffle' do
+    it_behaves_like 'shuffler'
+  end
+
+  describe '#permutation' do
+    it_behaves_like 'permutation sampler'
+  end
+
+  describe '#choice' do
+    it_behaves_like 'choice sampler'
+  end
 end
@@ -0,0 +1,64 @@
+# frozen_string_literal: true
+
+RSpec.describe Numo::Random::SeedSequence do
+  subject(:seq) { described_class.new(entropy: 42) }
+
+  describe '#initialize' do
+    it 'stores the given entropy', :aggregate_failures do
+      expect(seq.entropy).to eq(42)
+      expect(seq.spawn_key).to eq([])
+      expect(seq.pool_size).to eq(4)
+      expect(seq.n_children_spawned).to eq(0)
+    end
+
+    it 'draws fresh entropy when entropy is not given' do
+      expect(described_class.new.entropy).to be_a(Integer)
+    end
+
+    it 'raises ArgumentError when negative value is given to entropy' do
+      expect { described_class.new(entropy: -1) }.to raise_error(ArgumentError, 'entropy must be a non-negative value')
+    end
+
+    it 'raises TypeError when non-integer value is given to entropy' do
+      expect do
+        described_class.new(entropy: 1.5)
+      end.to raise_error(TypeError, 'entropy must be an Integer or an Array of Integers')
+    end
+
+    it 'raises ArgumentError when pool_size is less than 4' do
+      expect { described_class.new(pool_size: 2) }.to raise_error(ArgumentError, 'pool_size must be >= 4')
+    end
+  end
+
+  describe '#generate_state' do
+    it 'generates the same words as the reference implementation', :aggregate_failures do
+      state = described_class.new(entropy: [3735928559, 195939070, 229505742, 305419896]).generate_state(4)
+      expect(state).to be_a(Numo::UInt32)
+      expect(state.to_a).to eq([3914649087, 576849849, 3593928901, 2229911004])
+    end
+
+    it 'generates 64-bit words', :aggregate_failures do
+      state = described_class.new(entropy: 0).generate_state(2, dtype: :uint64)
+      expect(state).to be_a(Numo::UInt64)
+      expect(state.to_a).to eq([15793235383387715774, 12390638538380655177])
+    end
+
+    it 'generates different words for different entropy' do
+      expect(seq.generate_state(4).to_a).not_to eq(described_class.new(entropy: 43).generate_state(4).to_a)
+    end
+  end
+
+  describe '#spawn' do
+    it 'creates child seed sequences with successive spawn keys', :aggregate_failures do
+      children = seq.spawn(2) + seq.spawn(1)
+      expect(children.map(&:spawn_key)).to eq([[0], [1], [2]])
+      expect(children.map(&:entropy)).to all(eq(42))
+      expect(seq.n_children_spawned).to eq(3)
+    end
+
+    it 'creates child seed sequences that generate different words' do
+      states = seq.spawn(3).map { |child| child.generate_state(4).to_a }
+      expect(states.uniq.size).to eq(3)
+    end
+  end
+end
@@ -0,0 +1,395 @@
+# frozen_string_literal: true
+
+RSpec.shared_examples 'Bernoulli sampler' do
+  [Numo::Int8, Numo::Int16, Numo::Int32, Numo::Int64,
+   Numo::UInt8, Numo::UInt16, Numo::UInt32, Numo::UInt64].each do |klass|
+    context "when array type is #{klass}" do
+      let(:x) { klass.new(10_000).tap { |x| rng.bernoulli(x, p: 0.4) } }
+
+      it 'obtained randomized integer number from the Bernoulli distribution', :aggregate_failures do
+        expect(x).to be_a(klass)
+        expect(x.eq(1).count.fdiv(x.size)).to be_within(1e-2).of(0.4)
+      end
+    end
+  end
+
+  context 'when array type is Numo::Bit' do
+    let(:x) { Numo::Bit.new(10_000).tap { |x| rng.bernoulli(x, p: 0.4) } }
+
+    it 'obtained random bits from the Bernoulli distribution', :aggregate_failures do
+      expect(x).to be_a(Numo::Bit)
+      expect(x.count_true.fdiv(x.size)).to be_within(1e-2).of(0.4)
+    end
+  end
+
+  [Numo::SFloat, Numo::DFloat].each do |klass|
+    context "when array type is #{klass}" do
+      let(:x) { klass.new(5) }
+
+      it 'raises TypeError' do
+        expect do
+          rng.bernoulli(x, p: 0.5)
+        end.to raise_error(TypeError, 'invalid NArray class, it must be integer typed array or Bit')
+      end
+    end
+  end
+
+  context 'when a value out of [0, 1] is given to p' do
+    let(:x) { Numo::Bit.new(5) }
+
+    it 'raises ArgumentError' do
+      expect { rng.bernoulli(x, p: 1.1) }.to raise_error(ArgumentError, 'p must be >= 0 and <= 1')
+    end
+  end
+
+  it 'generates the same values from the same seed' do
+    x = Numo::Int32.new(100).tap { |a| rng.bernoulli(a, p: 0.4) }
+    y = Numo::Int32.new(100).tap { |a| described_class.new(seed: 42).bernoulli(a, p: 0.4) }
+    expect(x.to_a).to eq(y.to_a)
+  end
+end
+
+RSpec.shared_examples 'integers sampler' do
+  [Numo::Int8, Numo::Int16, Numo::Int32, Numo::Int64,
+   Numo::UInt8, Numo::UInt16, Numo::UInt32, Numo::UInt64].each do |klass|
+    context "when array type is #{klass}" do
+      let(:x) { klass.new(10_000).tap { |x| rng.integers(x, low: 1, high: 5) } }
+
+      it 'obtained random integers drawn uniformly from the interval', :aggregate_failures do
+        expect(x).to be_a(klass)
+        expect(x.min).to eq(1)
+        expect(x.max).to eq(4)
+        (1..4).each { |v| expect(x.eq(v).count.fdiv(x.size)).to be_within(2e-2).of(0.25) }
+      end
+    end
+  end
+
+  context 'when the interval is not a power of two' do
+    let(:x) { Numo::UInt32.new(10_000).tap { |x| rng.integers(x, low: 0, high: 3 * 2**30) } }
+
+    it 'obtained random integers without modulo bias', :aggregate_failures do
+      (0..2).each { |v| expect((x / 2**30).eq(v).count.fdiv(x.size)).to be_within(2e-2).of(1.fdiv(3)) }
+    end
+  end
+
+  context 'when the interval is wider than 2^32' do
+    let(:x) { Numo::Int64.new(10_000).tap { |x| rng.integers(x, low: -3 * 2**40, high: 0) } }
+
+    it 'obtained random integers drawn uniformly from the interval', :aggregate_failures do
+      (0..2).each { |v| expect(((x + 3 * 2**40) / 2**40).eq(v).count.fdiv(x.size)).to be_within(2e-2).of(1.fdiv(3)) }
+    end
+  end
+
+  [Numo::SFloat, Numo::DFloat].each do |klass|
+    context "when array type is #{klass}" do
+      let(:x) { klass.new(5) }
+
+      it 'raises TypeError' do
+        expect do
+          rng.integers(x, low: 0, high: 5)
+        end.to raise_error(TypeError, 'invalid NArray class, it must be integer typed array')
+      end
+    end
+  end
+
+  context 'when high is not greater than low' do
+    let(:x) { Numo::Int32.new(5) }
+
+    it 'raises ArgumentError' do
+      expect { rng.integers(x, low: 5, high: 5) }.to raise_error(ArgumentError, 'high must be > low')
+    end
+  end
+
+  context 'when the interval exceeds the range of array type' do
+    let(:x) { Numo::UInt8.new(5) }
+
+    it 'raises ArgumentError' do
+      expect do
+        rng.integers(x, low: 0, high: 257)
+      end.to raise_error(ArgumentError, 'low and high must be within the range of the array type')
+    end
+  end
+
+  it 'generates the same values from the same seed' do
+    x = Numo::Int64.new(100).tap { |a| rng.integers(a, low: -3 * 2**40, high: 5) }
+    y = Numo::Int64.new(100).tap { |a| described_class.new(seed: 42).integers(a, low: -3 * 2**40, high: 5) }
+    expect(x.to_a).to eq(y.to_a)
+  end
+end
+
+RSpec.shared_examples 'shuffler' do
+  [Numo::Int8, Numo::Int16, Numo::Int32, Numo::Int64,
+   Numo::UInt8, Numo::UInt16, Numo::UInt32, Numo::UInt64, Numo::SFloat, Numo::DFloat].each do |klass|
+    context "when array type is #{klass}" do
+      let(:x) { klass.cast(Array(0...100)).tap { |x| rng.shuffle(x) } }
+
+      it 'shuffles the elements in-place', :aggregate_failures do
+        expect(x).to be_a(klass)
+        expect(x.to_a.sort).to eq(Array(0...100))
+        expect(x.to_a).not_to eq(Array(0...100))
+      end
+    end
+  end
+
+  context 'when array type is Numo::Bit' do
+    let(:x) { Numo::Bit.cast([1, 0, 1] * 10 + [0] * 70).tap { |x| rng.shuffle(x) } }
+
+    it 'shuffles the bits in-place', :aggregate_failures do
+      expect(x).to be_a(Numo::Bit)
+      expect(x.count_true).to eq(20)
+      expect(x.to_a.take(30)).not_to eq([1, 0, 1] * 10)
+    end
+  end
+
+  context 'when the first axis is given' do
+    let(:x) { Numo::Int32.cast(Array(0...60)).tap { |x| x.reshape!(20, 3) }.tap { |x| rng.shuffle(x, axis: 0) } }
+
+    it 'shuffles the rows', :aggregate_failures do
+      rows = x.to_a.flatten.each_slice(3).to_a
+      expect(rows.sort).to eq(Array(0...60).each_slice(3).to_a)
+      expect(rows).not_to eq(Array(0...60).each_slice(3).to_a)
+    end
+  end
+
+  context 'when the last axis is given' do
+    let(:x) { Numo::Int32.cast(Array(0...60)).tap { |x| x.reshape!(3, 20) }.tap { |x| rng.shuffle(x, axis: -1) } }
+
+    it 'shuffles the columns', :aggregate_failures do
+      rows = x.to_a.flatten.each_slice(20).to_a
+      expect(rows.map(&:sort)).to eq(Array(0...60).each_slice(20).to_a)
+      expect(rows.map { |r| r.map { |v| v % 20 } }.uniq.size).to eq(1)
+      expect(rows[0]).not_to eq(Array(0...20))
+    end
+  end
+
+  context 'when view of array is given' do
+    let(:x) { Numo::Int32.cast(Array(0...100)) }
+
+    it 'shuffles only the elements of the view', :aggregate_failures do
+      rng.shuffle(x[50..-1])
+      expect(x[0...50].to_a).to eq(Array(0...50))
+      expect(x[50..-1].to_a.sort).to eq(Array(50...100))
+      expect(x[50..-1].to_a).not_to eq(Array(50...100))
+    end
+
+    it 'shuffles only the row of the view', :aggregate_failures do
+      x.reshape!(2, 50)
+      rng.shuffle(x[1, true])
+      expect(x[0, true].to_a).to eq(Array(0...50))
+      expect(x[1, true].to_a.sort).to eq(Array(50...100))
+      expect(x[1, true].to_a).not_to eq(Array(50...100))
+    end
+  end
+
+  context 'when axis is out of range' do
+    let(:x) { Numo::DFloat.new(3, 2) }
+
+    it 'raises ArgumentError' do
+      expect { rng.shuffle(x, axis: 2) }.to raise_error(ArgumentError, 'axis must be >= -2 and < 2')
+    end
+  end
+
+  context 'when x is not Numo::NArray' do
+    it 'raises TypeError' do
+      expect { rng.shuffle([1, 2, 3]) }.to raise_error(TypeError, 'x must be Numo::NArray')
+    end
+  end
+
+  it 'shuffles in the same order from the same seed' do
+    x = Numo::Int32.cast(Array(0...100)).tap { |a| rng.shuffle(a) }
+    y = Numo::Int32.cast(Array(0...100)).tap { |a| described_class.new(seed: 42).shuffle(a) }
+    expect(x.to_a).to eq(y.to_a)
+  end
+end
+
+RSpec.shared_examples 'permutation sampler' do
+  [Numo::Int8, Numo::Int16, Numo::Int32, Numo::Int64,
+   Numo::UInt8, Numo::UInt16, Numo::UInt32, Numo::UInt64].each do |klass|
+    context "when array type is #{klass}" do
+      let(:x) { klass.new(100).tap { |x| rng.permutation(x) } }
+
+      it 'obtains a random permutation', :aggregate_failures do
+        expect(x).to be_a(klass)
+        expect(x.to_a.sort).to eq(Array(0...100))
+        expect(x.to_a).not_to eq(Array(0...100))
+      end
+    end
+  end
+
+  [Numo::SFloat, Numo::DFloat].each do |klass|
+    context "when array type is #{klass}" do
+      let(:x) { klass.new(5) }
+
+      it 'raises TypeError' do
+        expect do
+          rng.permutation(x)
+        end.to raise_error(TypeError, 'invalid NArray class, it must be integer typed array')
+      end
+    end
+  end
+
+  context 'when view of array is given' do
+    let(:x) { Numo::Int32.new(150).fill(-1).tap { |x| rng.permutation(x[50...150]) } }
+
+    it 'writes the permutation only to the elements of the view', :aggregate_failures do
+      expect(x[0...50].to_a).to eq([-1] * 50)
+      expect(x[50...150].to_a.sort).to eq(Array(0...100))
+    end
+  end
+
+  context 'when array size exceeds the range of the array type' do
+    let(:x) { Numo::Int8.new(200) }
+
+    it 'raises ArgumentError' do
+      expect do
+        rng.permutation(x)
+      end.to raise_error(ArgumentError, 'size of array must be within the range of the array type')
+    end
+  end
+
+  it 'generates the same permutation from the same seed' do
+    x = Numo::Int32.new(100).tap { |a| rng.permutation(a) }
+    y = Numo::Int32.new(100).tap { |a| described_class.new(seed: 42).permutation(a) }
+    expect(x.to_a).to eq(y.to_a)
+  end
+end
+
+RSpec.shared_examples 'choice sampler' do
+  [Numo::Int8, Numo::Int16, Numo::Int32, Numo::Int64,
+   Numo::UInt8, Numo::UInt16, Numo::UInt32, Numo::UInt64].each do |klass|
+    context "when array type is #{klass}" do
+      let(:x) { klass.new(10_000).tap { |x| rng.choice(x, n: 4) } }
+
+      it 'obtains random indices drawn uniformly with replacement', :aggregate_failures do
+        expect(x).to be_a(klass)
+        (0..3).each { |v| expect(x.eq(v).count.fdiv(x.size)).to be_within(2e-2).of(0.25) }
+      end
+    end
+  end
+
+  context 'when weight is given' do
+    let(:x) { Numo::Int32.new(10_000).tap { |x| rng.choice(x, n: 3, weight: Numo::DFloat[1, 3, 0]) } }
+
+    it 'obtains random indices drawn with the probabilities proportional to the weights', :aggregate_failures do
+      expect(x.eq(1).count.fdiv(x.size)).to be_within(2e-2).of(0.75)
+      expect(x.eq(2).count).to eq(0)
+    end
+  end
+
+  context 'when view of weight is given' do
+    let(:weight) { Numo::DFloat[5, 0, 1, 3][1..-1] }
+    let(:x) { Numo::Int32.new(10_000).tap { |x| rng.choice(x, n: 3, weight: weight) } }
+    let(:samples) { Array.new(100) { Numo::Int32.new(2).tap { |x| rng.choice(x, n: 3, replace: false, weight: weight) }.to_a } }
+
+    it 'obtains random indices drawn with the weights of the view', :aggregate_failures do
+      expect(x.eq(0).count).to eq(0)
+      expect(x.eq(2).count.fdiv(x.size)).to be_within(2e-2).of(0.75)
+      expect(samples.map(&:sort)).to all(eq([1, 2]))
+    end
+  end
+
+  context 'when view of array is given without replacement' do
+    let(:x) { Numo::Int32.new(10).fill(-1) }
+
+    it 'writes the sample only to the elements of the view', :aggregate_failures do
+      rng.choice(x[3..-1], n: 7, replace: false)
+      expect(x[0...3].to_a).to eq([-1] * 3)
+      expect(x[3..-1].to_a.sort).to eq(Array(0...7))
+      rng.choice(x[3..-1], n: 1000, replace: false)
+      expect(x[0...3].to_a).to eq([-1] * 3)
+      expect(x[3..-1].to_a.uniq.size).to eq(7)
+      expect(x[3..-1].to_a).to all(be_between(0, 999))
+      rng.choice(x[3..-1], n: 7, replace: false, weight: Numo::DFloat.ones(7))
+      expect(x[0...3].to_a).to eq([-1] * 3)
+      expect(x[3..-1].to_a.sort).to eq(Array(0...7))
+    end
+  end
+
+  context 'when replace is false and the sample is large compared to the candidates' do
+    let(:samples) { Array.new(4000) { Numo::Int32.new(3).tap { |x| rng.choice(x, n: 4, replace: false) }.to_a } }
+
+    it 'obtains distinct indices drawn uniformly', :aggregate_failures do
+      expect(samples.map(&:uniq).map(&:size)).to all(eq(3))
+      (0..3).each { |v| expect(samples.count { |s| s[2] == v }.fdiv(4000)).to be_within(3e-2).of(0.25) }
+    end
+  end
+
+  context 'when replace is false and the sample is small compared to the candidates' do
+    let(:samples) { Array.new(4000) { Numo::Int64.new(2).tap { |x| rng.choice(x, n: 1000, replace: false) }.to_a } }
+
+    it 'obtains distinct indices drawn uniformly', :aggregate_failures do
+      expect(samples.map(&:uniq).map(&:size)).to all(eq(2))
+      expect(samples.flatten).to all(be_between(0, 999))
+      expect(samples.count { |s| s[0] < 500 }.fdiv(4000)).to be_within(3e-2).of(0.5)
+      expect(samples.count { |s| s[1] < 500 }.fdiv(4000)).to be_within(3e-2).of(0.5)
+    end
+  end
+
+  context 'when replace is false and weight is given' do
+    let(:weight) { Numo::DFloat[1, 2, 3, 4, 0] }
+    let(:samples) do
+      Array.new(4000) { Numo::UInt8.new(2).tap { |x| rng.choice(x, n: 5, replace: false, weight: weight) }.to_a }
+    end
+
+    it 'obtains distinct indices drawn successively with the probabilities proportional to the weights',
+       :aggregate_failures do
+      expect(samples.map(&:uniq).map(&:size)).to all(eq(2))
+      expect(samples.flatten).to all(be_between(0, 3))
+      (0..3).each { |v| expect(samples.count { |s| s[0] == v }.fdiv(4000)).to be_within(3e-2).of(0.1 * (v + 1)) }
+    end
+  end
+
+  context 'when array type is not integer' do
+    let(:x) { Numo::DFloat.new(5) }
+
+    it 'raises TypeError' do
+      expect do
+        rng.choice(x, n: 5)
+      end.to raise_error(TypeError, 'invalid NArray class, it must be integer typed array')
+    end
+  end
+
+  context 'when n exceeds the range of the array type' do
+    let(:x) { Numo::Int8.new(5) }
+
+    it 'raises ArgumentError' do
+      expect { rng.choice(x, n: 200) }.to raise_error(ArgumentError, 'n must be within the range of the array type')
+    end
+  end
+
+  context 'when the sample is larger than the candidates without replacement' do
+    let(:x) { Numo::Int32.new(5) }
+
+    it 'raises ArgumentError' do
+      expect do
+        rng.choice(x, n: 4, replace: false)
+      end.to raise_error(ArgumentError, 'size of array must be <= n when replace is false')
+    end
+  end
+
+  context 'when the length of weight does not match n' do
+    let(:x) { Numo::Int32.new(5) }
+
+    it 'raises ArgumentError' do
+      expect do
+        rng.choice(x, n: 4, weight: Numo::DFloat[1, 2, 3])
+      end.to raise_error(ArgumentError, 'length of weight must be equal to n')
+    end
+  end
+
+  context 'when the positive weights are fewer than the sample without replacement' do
+    let(:x) { Numo::Int32.new(3) }
+
+    it 'raises ArgumentError' do
+      expect do
+        rng.choice(x, n: 4, replace: false, weight: Numo::DFloat[1, 2, 0, 0])
+      end.to raise_error(ArgumentError, 'number of positive weights must be >= size of array')
+    end
+  end
+
+  it 'generates the same values from the same seed' do
+    x = Numo::Int32.new(100).tap { |a| rng.choice(a, n: 1000, replace: false) }
+    y = Numo::Int32.new(100).tap { |a| described_class.new(seed: 42).choice(a, n: 1000, replace: false) }
+    expect(x.to_a).to eq(y.to_a)
+  end
+end